@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/load_client.dir/src/load_client.cpp.o"
+  "CMakeFiles/load_client.dir/src/load_client.cpp.o.d"
+  "load_client"
+  "load_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/load_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
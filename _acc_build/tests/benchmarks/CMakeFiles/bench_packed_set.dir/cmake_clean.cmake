@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_packed_set.dir/src/packed_set.cpp.o"
+  "CMakeFiles/bench_packed_set.dir/src/packed_set.cpp.o.d"
+  "bench_packed_set"
+  "bench_packed_set.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_packed_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
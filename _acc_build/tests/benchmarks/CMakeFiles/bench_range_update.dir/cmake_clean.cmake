@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_range_update.dir/src/range_update.cpp.o"
+  "CMakeFiles/bench_range_update.dir/src/range_update.cpp.o.d"
+  "bench_range_update"
+  "bench_range_update.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_range_update.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
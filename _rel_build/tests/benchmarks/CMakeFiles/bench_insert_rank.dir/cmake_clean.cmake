@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_insert_rank.dir/src/insert_rank.cpp.o"
+  "CMakeFiles/bench_insert_rank.dir/src/insert_rank.cpp.o.d"
+  "bench_insert_rank"
+  "bench_insert_rank.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_insert_rank.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_succinct.dir/src/succinct.cpp.o"
+  "CMakeFiles/bench_succinct.dir/src/succinct.cpp.o.d"
+  "bench_succinct"
+  "bench_succinct.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_succinct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,213 @@
+add_test([=[Adaptive_Tree.Freezes_After_Reads]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Adaptive_Tree.Freezes_After_Reads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adaptive_Tree.Freezes_After_Reads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adaptive_Tree.Freezes_After_Size_Reads]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Adaptive_Tree.Freezes_After_Size_Reads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adaptive_Tree.Freezes_After_Size_Reads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adaptive_Tree.Thaws_On_Change]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Adaptive_Tree.Thaws_On_Change]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adaptive_Tree.Thaws_On_Change]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adaptive_Tree.Write_Cancels_Freezing]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Adaptive_Tree.Write_Cancels_Freezing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adaptive_Tree.Write_Cancels_Freezing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adaptive_Tree.Frozen_Lookups]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Adaptive_Tree.Frozen_Lookups]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adaptive_Tree.Frozen_Lookups]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Adaptive_Tree.Random_Phases]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Adaptive_Tree.Random_Phases]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Adaptive_Tree.Random_Phases]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Hinted_Insert.Ascending_Keys]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Hinted_Insert.Ascending_Keys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Hinted_Insert.Ascending_Keys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Hinted_Insert.Arbitrary_Hints]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Hinted_Insert.Arbitrary_Hints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Hinted_Insert.Arbitrary_Hints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Buffered_Tree.Contains_Checks_Buffer]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Buffered_Tree.Contains_Checks_Buffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Buffered_Tree.Contains_Checks_Buffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Buffered_Tree.Contains_Checks_Sorted_Runs]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Buffered_Tree.Contains_Checks_Sorted_Runs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Buffered_Tree.Contains_Checks_Sorted_Runs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Buffered_Tree.Queries_Merge_Buffer]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Buffered_Tree.Queries_Merge_Buffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Buffered_Tree.Queries_Merge_Buffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Buffered_Tree.Random_Keys]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Buffered_Tree.Random_Keys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Buffered_Tree.Random_Keys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RB_Tree.Version]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=RB_Tree.Version]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RB_Tree.Version]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Cached_Tree.Repeated_Queries_Hit]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Cached_Tree.Repeated_Queries_Hit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Cached_Tree.Repeated_Queries_Hit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Cached_Tree.Updates_Invalidate]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Cached_Tree.Updates_Invalidate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Cached_Tree.Updates_Invalidate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Cached_Tree.Matches_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Cached_Tree.Matches_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Cached_Tree.Matches_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Cached_Tree.Disabled]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Cached_Tree.Disabled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Cached_Tree.Disabled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Node_Arena.Nodes_Do_Not_Cross_Pages]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Node_Arena.Nodes_Do_Not_Cross_Pages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Node_Arena.Nodes_Do_Not_Cross_Pages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Node_Arena.Destroy_Last]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Node_Arena.Destroy_Last]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Node_Arena.Destroy_Last]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Node_Arena.Destroy_Reuses_Slots]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Node_Arena.Destroy_Reuses_Slots]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Node_Arena.Destroy_Reuses_Slots]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Serialization.Round_Trip]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Serialization.Round_Trip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Serialization.Round_Trip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Serialization.Rejects_Bad_Data]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Serialization.Rejects_Bad_Data]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Serialization.Rejects_Bad_Data]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Checkpoint.Snapshot_Is_Taken_At_Fork]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Checkpoint.Snapshot_Is_Taken_At_Fork]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Checkpoint.Snapshot_Is_Taken_At_Fork]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Combining_Tree.Matches_Set]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Combining_Tree.Matches_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Combining_Tree.Matches_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Combining_Tree.Concurrent_Updates]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Combining_Tree.Concurrent_Updates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Combining_Tree.Concurrent_Updates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Combining_Tree.Same_Key_From_Many_Threads]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Combining_Tree.Same_Key_From_Many_Threads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Combining_Tree.Same_Key_From_Many_Threads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Details.Left_Tree_Rotation]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Details.Left_Tree_Rotation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Details.Left_Tree_Rotation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Details.Right_Tree_Rotation]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Details.Right_Tree_Rotation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Details.Right_Tree_Rotation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[End_Node.Move_Constructor]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=End_Node.Move_Constructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[End_Node.Move_Constructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[End_Node.Move_Assignment]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=End_Node.Move_Assignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[End_Node.Move_Assignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Erase.Single]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Erase.Single]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Erase.Single]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Erase.Random]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Erase.Random]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Erase.Random]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Erase.Order_Statistics]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Erase.Order_Statistics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Erase.Order_Statistics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Erase.Relaxed_And_Unbalanced]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Erase.Relaxed_And_Unbalanced]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Erase.Relaxed_And_Unbalanced]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Erase.Slots_Are_Reused_In_Batches]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Erase.Slots_Are_Reused_In_Batches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Erase.Slots_Are_Reused_In_Batches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Export.Empty]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Export.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Export.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Export.Matches_Iteration]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Export.Matches_Iteration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Export.Matches_Iteration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Fractional_Cascade.Empty_Family]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Fractional_Cascade.Empty_Family]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Fractional_Cascade.Empty_Family]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Fractional_Cascade.Small_Catalogs]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Fractional_Cascade.Small_Catalogs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Fractional_Cascade.Small_Catalogs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Fractional_Cascade.Matches_Every_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Fractional_Cascade.Matches_Every_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Fractional_Cascade.Matches_Every_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Iterators.Check_Iterator_Concept]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Iterators.Check_Iterator_Concept]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Iterators.Check_Iterator_Concept]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KLL_Sketch.Exact_While_Small]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=KLL_Sketch.Exact_While_Small]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KLL_Sketch.Exact_While_Small]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KLL_Sketch.Error_And_Memory_Are_Bounded]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=KLL_Sketch.Error_And_Memory_Are_Bounded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KLL_Sketch.Error_And_Memory_Are_Bounded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KLL_Sketch.Merge]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=KLL_Sketch.Merge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KLL_Sketch.Merge]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KLL_Sketch.Self_Merge]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=KLL_Sketch.Self_Merge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KLL_Sketch.Self_Merge]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KLL_Sketch.Larger_K_Is_More_Accurate]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=KLL_Sketch.Larger_K_Is_More_Accurate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KLL_Sketch.Larger_K_Is_More_Accurate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lock_Free_Tree.Matches_Set]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Lock_Free_Tree.Matches_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lock_Free_Tree.Matches_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lock_Free_Tree.Non_Trivial_Keys]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Lock_Free_Tree.Non_Trivial_Keys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lock_Free_Tree.Non_Trivial_Keys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lock_Free_Tree.Sorted_Keys_Stay_Balanced]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Lock_Free_Tree.Sorted_Keys_Stay_Balanced]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lock_Free_Tree.Sorted_Keys_Stay_Balanced]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lock_Free_Tree.Concurrent_Ascending_Keys]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Lock_Free_Tree.Concurrent_Ascending_Keys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lock_Free_Tree.Concurrent_Ascending_Keys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lock_Free_Tree.Concurrent_Disjoint_Ranges]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Lock_Free_Tree.Concurrent_Disjoint_Ranges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lock_Free_Tree.Concurrent_Disjoint_Ranges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Lock_Free_Tree.Concurrent_Contended_Keys]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Lock_Free_Tree.Concurrent_Contended_Keys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Lock_Free_Tree.Concurrent_Contended_Keys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Merge_From.Both_Strategies]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Merge_From.Both_Strategies]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Merge_From.Both_Strategies]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Merge_From.Another_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Merge_From.Another_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Merge_From.Another_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Merge_From.Unbalanced_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Merge_From.Unbalanced_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Merge_From.Unbalanced_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Merge_From.Rolled_Back_Within_Batch]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Merge_From.Rolled_Back_Within_Batch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Merge_From.Rolled_Back_Within_Batch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Order_Statistics.Empty_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Order_Statistics.Empty_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Order_Statistics.Empty_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Order_Statistics.Kth_Smallest]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Order_Statistics.Kth_Smallest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Order_Statistics.Kth_Smallest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Order_Statistics.Count_Less]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Order_Statistics.Count_Less]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Order_Statistics.Count_Less]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Order_Statistics.Random_Inserts]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Order_Statistics.Random_Inserts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Order_Statistics.Random_Inserts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Order_Statistics.Descending_Inserts]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Order_Statistics.Descending_Inserts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Order_Statistics.Descending_Inserts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Order_Statistics.Copy_Keeps_Sizes]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Order_Statistics.Copy_Keeps_Sizes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Order_Statistics.Copy_Keeps_Sizes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Order_Statistics.Insert_With_Rank]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Order_Statistics.Insert_With_Rank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Order_Statistics.Insert_With_Rank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Order_Statistics.Counting_Inversions]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Order_Statistics.Counting_Inversions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Order_Statistics.Counting_Inversions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Packed_Set.Empty]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Packed_Set.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Packed_Set.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Packed_Set.Bulk_Load]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Packed_Set.Bulk_Load]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Packed_Set.Bulk_Load]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Packed_Set.Insert]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Packed_Set.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Packed_Set.Insert]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Packed_Set.Ascending_Inserts]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Packed_Set.Ascending_Inserts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Packed_Set.Ascending_Inserts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RB_Map.Empty]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=RB_Map.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RB_Map.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RB_Map.Range_Add]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=RB_Map.Range_Add]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RB_Map.Range_Add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RB_Map.Matches_Map]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=RB_Map.Matches_Map]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RB_Map.Matches_Map]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Rebuild_By_Frequency.Keeps_Contents]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Rebuild_By_Frequency.Keeps_Contents]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Rebuild_By_Frequency.Keeps_Contents]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Rebuild_By_Frequency.Reduces_Expected_Depth]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Rebuild_By_Frequency.Reduces_Expected_Depth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Rebuild_By_Frequency.Reduces_Expected_Depth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Rebuild_By_Frequency.Uniform_Weights_Give_Balanced_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Rebuild_By_Frequency.Uniform_Weights_Give_Balanced_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Rebuild_By_Frequency.Uniform_Weights_Give_Balanced_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Rebuild_By_Frequency.Insertion_Restores_Red_Black_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Rebuild_By_Frequency.Insertion_Restores_Red_Black_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Rebuild_By_Frequency.Insertion_Restores_Red_Black_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Rebuild_By_Frequency.Empty_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Rebuild_By_Frequency.Empty_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Rebuild_By_Frequency.Empty_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Rebalance_Perfect.Minimal_Height]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Rebalance_Perfect.Minimal_Height]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Rebalance_Perfect.Minimal_Height]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Rebalance_Perfect.After_Rebuild_By_Frequency]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Rebalance_Perfect.After_Rebuild_By_Frequency]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Rebalance_Perfect.After_Rebuild_By_Frequency]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Relaxed_Balance.Repairs_Incrementally]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Relaxed_Balance.Repairs_Incrementally]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Relaxed_Balance.Repairs_Incrementally]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Relaxed_Balance.Keeps_Height_Bound]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Relaxed_Balance.Keeps_Height_Bound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Relaxed_Balance.Keeps_Height_Bound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Relaxed_Balance.Mixed_With_Immediate_Fixup]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Relaxed_Balance.Mixed_With_Immediate_Fixup]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Relaxed_Balance.Mixed_With_Immediate_Fixup]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Relaxed_Balance.Background_Thread]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Relaxed_Balance.Background_Thread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Relaxed_Balance.Background_Thread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Sequential_Access.Ascending_And_Descending_Inserts]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Sequential_Access.Ascending_And_Descending_Inserts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Sequential_Access.Ascending_And_Descending_Inserts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Sequential_Access.Cursor_Lookups]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Sequential_Access.Cursor_Lookups]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Sequential_Access.Cursor_Lookups]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Sequential_Access.Cursor_Starts_Over_After_Changes]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Sequential_Access.Cursor_Starts_Over_After_Changes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Sequential_Access.Cursor_Starts_Over_After_Changes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Sequential_Access.Lookups_Do_Not_Write]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Sequential_Access.Lookups_Do_Not_Write]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Sequential_Access.Lookups_Do_Not_Write]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Sequential_Access.Rollback_Forgets_Finger]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Sequential_Access.Rollback_Forgets_Finger]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Sequential_Access.Rollback_Forgets_Finger]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SG_Tree.Empty]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=SG_Tree.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SG_Tree.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SG_Tree.Ascending_Inserts_Stay_Low]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=SG_Tree.Ascending_Inserts_Stay_Low]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SG_Tree.Ascending_Inserts_Stay_Low]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SG_Tree.Random_Against_Set]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=SG_Tree.Random_Against_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SG_Tree.Random_Against_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SG_Tree.Erase_All]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=SG_Tree.Erase_All]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SG_Tree.Erase_All]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SG_Tree.Copy_And_Move]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=SG_Tree.Copy_And_Move]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SG_Tree.Copy_And_Move]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Concurrent_Skip_List.Matches_Set]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Concurrent_Skip_List.Matches_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Concurrent_Skip_List.Matches_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Concurrent_Skip_List.Non_Trivial_Keys]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Concurrent_Skip_List.Non_Trivial_Keys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Concurrent_Skip_List.Non_Trivial_Keys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Concurrent_Skip_List.Concurrent_Disjoint_Ranges]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Concurrent_Skip_List.Concurrent_Disjoint_Ranges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Concurrent_Skip_List.Concurrent_Disjoint_Ranges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Concurrent_Skip_List.Concurrent_Contended_Keys]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Concurrent_Skip_List.Concurrent_Contended_Keys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Concurrent_Skip_List.Concurrent_Contended_Keys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Bit_Vector.Rank_Select]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Bit_Vector.Rank_Select]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Bit_Vector.Rank_Select]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Succinct_Tree.Empty]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Succinct_Tree.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Succinct_Tree.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Succinct_Tree.Matches_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Succinct_Tree.Matches_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Succinct_Tree.Matches_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Top_K.Keeps_Greatest]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Top_K.Keeps_Greatest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Top_K.Keeps_Greatest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Top_K.Rejects_And_Ignores_Duplicates]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Top_K.Rejects_And_Ignores_Duplicates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Top_K.Rejects_And_Ignores_Duplicates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Transactions.Commit]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Transactions.Commit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Transactions.Commit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Transactions.Rollback_Restores_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Transactions.Rollback_Restores_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Transactions.Rollback_Restores_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Transactions.Rollback_Undoes_Rotations]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Transactions.Rollback_Undoes_Rotations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Transactions.Rollback_Undoes_Rotations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Transactions.Rollback_Of_Empty_Tree]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Transactions.Rollback_Of_Empty_Tree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Transactions.Rollback_Of_Empty_Tree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Transactions.Relaxed_Mode]=]  /root/repo/_rel_build/tests/unit_tests/unit_tests [==[--gtest_filter=Transactions.Relaxed_Mode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Transactions.Relaxed_Mode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build/tests/unit_tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  unit_tests_TESTS Adaptive_Tree.Freezes_After_Reads Adaptive_Tree.Freezes_After_Size_Reads Adaptive_Tree.Thaws_On_Change Adaptive_Tree.Write_Cancels_Freezing Adaptive_Tree.Frozen_Lookups Adaptive_Tree.Random_Phases Hinted_Insert.Ascending_Keys Hinted_Insert.Arbitrary_Hints Buffered_Tree.Contains_Checks_Buffer Buffered_Tree.Contains_Checks_Sorted_Runs Buffered_Tree.Queries_Merge_Buffer Buffered_Tree.Random_Keys RB_Tree.Version Cached_Tree.Repeated_Queries_Hit Cached_Tree.Updates_Invalidate Cached_Tree.Matches_Tree Cached_Tree.Disabled Node_Arena.Nodes_Do_Not_Cross_Pages Node_Arena.Destroy_Last Node_Arena.Destroy_Reuses_Slots Serialization.Round_Trip Serialization.Rejects_Bad_Data Checkpoint.Snapshot_Is_Taken_At_Fork Combining_Tree.Matches_Set Combining_Tree.Concurrent_Updates Combining_Tree.Same_Key_From_Many_Threads Details.Left_Tree_Rotation Details.Right_Tree_Rotation End_Node.Move_Constructor End_Node.Move_Assignment Erase.Single Erase.Random Erase.Order_Statistics Erase.Relaxed_And_Unbalanced Erase.Slots_Are_Reused_In_Batches Export.Empty Export.Matches_Iteration Fractional_Cascade.Empty_Family Fractional_Cascade.Small_Catalogs Fractional_Cascade.Matches_Every_Tree Iterators.Check_Iterator_Concept KLL_Sketch.Exact_While_Small KLL_Sketch.Error_And_Memory_Are_Bounded KLL_Sketch.Merge KLL_Sketch.Self_Merge KLL_Sketch.Larger_K_Is_More_Accurate Lock_Free_Tree.Matches_Set Lock_Free_Tree.Non_Trivial_Keys Lock_Free_Tree.Sorted_Keys_Stay_Balanced Lock_Free_Tree.Concurrent_Ascending_Keys Lock_Free_Tree.Concurrent_Disjoint_Ranges Lock_Free_Tree.Concurrent_Contended_Keys Merge_From.Both_Strategies Merge_From.Another_Tree Merge_From.Unbalanced_Tree Merge_From.Rolled_Back_Within_Batch Order_Statistics.Empty_Tree Order_Statistics.Kth_Smallest Order_Statistics.Count_Less Order_Statistics.Random_Inserts Order_Statistics.Descending_Inserts Order_Statistics.Copy_Keeps_Sizes Order_Statistics.Insert_With_Rank Order_Statistics.Counting_Inversions Packed_Set.Empty Packed_Set.Bulk_Load Packed_Set.Insert Packed_Set.Ascending_Inserts RB_Map.Empty RB_Map.Range_Add RB_Map.Matches_Map Rebuild_By_Frequency.Keeps_Contents Rebuild_By_Frequency.Reduces_Expected_Depth Rebuild_By_Frequency.Uniform_Weights_Give_Balanced_Tree Rebuild_By_Frequency.Insertion_Restores_Red_Black_Tree Rebuild_By_Frequency.Empty_Tree Rebalance_Perfect.Minimal_Height Rebalance_Perfect.After_Rebuild_By_Frequency Relaxed_Balance.Repairs_Incrementally Relaxed_Balance.Keeps_Height_Bound Relaxed_Balance.Mixed_With_Immediate_Fixup Relaxed_Balance.Background_Thread Sequential_Access.Ascending_And_Descending_Inserts Sequential_Access.Cursor_Lookups Sequential_Access.Cursor_Starts_Over_After_Changes Sequential_Access.Lookups_Do_Not_Write Sequential_Access.Rollback_Forgets_Finger SG_Tree.Empty SG_Tree.Ascending_Inserts_Stay_Low SG_Tree.Random_Against_Set SG_Tree.Erase_All SG_Tree.Copy_And_Move Concurrent_Skip_List.Matches_Set Concurrent_Skip_List.Non_Trivial_Keys Concurrent_Skip_List.Concurrent_Disjoint_Ranges Concurrent_Skip_List.Concurrent_Contended_Keys Bit_Vector.Rank_Select Succinct_Tree.Empty Succinct_Tree.Matches_Tree Top_K.Keeps_Greatest Top_K.Rejects_And_Ignores_Duplicates Transactions.Commit Transactions.Rollback_Restores_Tree Transactions.Rollback_Undoes_Rotations Transactions.Rollback_Of_Empty_Tree Transactions.Relaxed_Mode)
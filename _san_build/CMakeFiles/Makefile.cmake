@@ -0,0 +1,86 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/server/CMakeLists.txt"
+  "/root/repo/tests/benchmarks/CMakeLists.txt"
+  "/root/repo/tests/unit_tests/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "tests/unit_tests/CMakeFiles/unit_tests.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_write_buffer.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_checkpoint.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_quantile_sketch.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_cascade.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_merge.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_concurrent_tree.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_succinct.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_packed_set.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_cached_tree.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_sequential.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_export.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_range_update.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_top_k.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_scapegoat.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_rebalance.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_flat_combining.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_insert_rank.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/bench_adaptive.dir/DependInfo.cmake"
+  "server/CMakeFiles/tree_server.dir/DependInfo.cmake"
+  "server/CMakeFiles/load_client.dir/DependInfo.cmake"
+  "server/CMakeFiles/server_tests.dir/DependInfo.cmake"
+  )
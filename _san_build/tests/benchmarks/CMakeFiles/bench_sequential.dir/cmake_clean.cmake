@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_sequential.dir/src/sequential.cpp.o"
+  "CMakeFiles/bench_sequential.dir/src/sequential.cpp.o.d"
+  "bench_sequential"
+  "bench_sequential.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_sequential.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_top_k.dir/src/top_k.cpp.o"
+  "CMakeFiles/bench_top_k.dir/src/top_k.cpp.o.d"
+  "bench_top_k"
+  "bench_top_k.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_top_k.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_write_buffer.dir/src/write_buffer.cpp.o"
+  "CMakeFiles/bench_write_buffer.dir/src/write_buffer.cpp.o.d"
+  "bench_write_buffer"
+  "bench_write_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_write_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
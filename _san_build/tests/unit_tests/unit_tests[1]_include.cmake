@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_san_build/tests/unit_tests/unit_tests[1]_tests.cmake")
+  include("/root/repo/_san_build/tests/unit_tests/unit_tests[1]_tests.cmake")
+else()
+  add_test(unit_tests_NOT_BUILT unit_tests_NOT_BUILT)
+endif()
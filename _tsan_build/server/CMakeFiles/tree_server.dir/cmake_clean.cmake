@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tree_server.dir/src/server.cpp.o"
+  "CMakeFiles/tree_server.dir/src/server.cpp.o.d"
+  "tree_server"
+  "tree_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tree_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
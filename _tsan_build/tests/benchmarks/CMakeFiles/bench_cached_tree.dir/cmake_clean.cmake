@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_cached_tree.dir/src/cached_tree.cpp.o"
+  "CMakeFiles/bench_cached_tree.dir/src/cached_tree.cpp.o.d"
+  "bench_cached_tree"
+  "bench_cached_tree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_cached_tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
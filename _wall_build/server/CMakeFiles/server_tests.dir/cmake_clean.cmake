@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/server_tests.dir/tests/main.cpp.o"
+  "CMakeFiles/server_tests.dir/tests/main.cpp.o.d"
+  "CMakeFiles/server_tests.dir/tests/server.cpp.o"
+  "CMakeFiles/server_tests.dir/tests/server.cpp.o.d"
+  "server_tests"
+  "server_tests.pdb"
+  "server_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/server_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/server
+# Build directory: /root/repo/_wall_build/server
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_wall_build/server/server_tests[1]_include.cmake")
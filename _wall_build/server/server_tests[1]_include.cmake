@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_wall_build/server/server_tests[1]_tests.cmake")
+  include("/root/repo/_wall_build/server/server_tests[1]_tests.cmake")
+else()
+  add_test(server_tests_NOT_BUILT server_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+add_test([=[Server.Pipelined_Requests_Keep_Order]=]  /root/repo/_wall_build/server/server_tests [==[--gtest_filter=Server.Pipelined_Requests_Keep_Order]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Server.Pipelined_Requests_Keep_Order]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_wall_build/server SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Server.Responds_After_Half_Close]=]  /root/repo/_wall_build/server/server_tests [==[--gtest_filter=Server.Responds_After_Half_Close]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Server.Responds_After_Half_Close]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_wall_build/server SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  server_tests_TESTS Server.Pipelined_Requests_Keep_Order Server.Responds_After_Half_Close)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_concurrent_tree.dir/src/concurrent_tree.cpp.o"
+  "CMakeFiles/bench_concurrent_tree.dir/src/concurrent_tree.cpp.o.d"
+  "bench_concurrent_tree"
+  "bench_concurrent_tree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_concurrent_tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
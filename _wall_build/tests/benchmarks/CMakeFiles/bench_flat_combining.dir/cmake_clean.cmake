@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_flat_combining.dir/src/flat_combining.cpp.o"
+  "CMakeFiles/bench_flat_combining.dir/src/flat_combining.cpp.o.d"
+  "bench_flat_combining"
+  "bench_flat_combining.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_flat_combining.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_quantile_sketch.dir/src/quantile_sketch.cpp.o"
+  "CMakeFiles/bench_quantile_sketch.dir/src/quantile_sketch.cpp.o.d"
+  "bench_quantile_sketch"
+  "bench_quantile_sketch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_quantile_sketch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_scapegoat.dir/src/scapegoat.cpp.o"
+  "CMakeFiles/bench_scapegoat.dir/src/scapegoat.cpp.o.d"
+  "bench_scapegoat"
+  "bench_scapegoat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_scapegoat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
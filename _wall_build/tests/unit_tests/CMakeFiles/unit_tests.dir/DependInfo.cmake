@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/unit_tests/src/adaptive_tree.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/adaptive_tree.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/adaptive_tree.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/buffered_tree.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/buffered_tree.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/buffered_tree.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/cached_tree.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/cached_tree.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/cached_tree.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/checkpoint.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/checkpoint.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/checkpoint.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/combining_tree.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/combining_tree.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/combining_tree.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/details.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/details.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/details.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/end_node.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/end_node.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/end_node.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/erase.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/erase.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/erase.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/export.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/export.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/export.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/fractional_cascade.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/fractional_cascade.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/fractional_cascade.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/heatmap.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/heatmap.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/heatmap.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/iterators.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/iterators.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/iterators.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/kll_sketch.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/kll_sketch.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/kll_sketch.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/lock_free_tree.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/lock_free_tree.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/lock_free_tree.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/main.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/main.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/main.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/merge_from.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/merge_from.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/merge_from.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/order_statistics.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/order_statistics.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/order_statistics.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/packed_set.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/packed_set.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/packed_set.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/rb_map.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/rb_map.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/rb_map.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/rebuild.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/rebuild.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/rebuild.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/relaxed_balance.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/relaxed_balance.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/relaxed_balance.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/sequential_access.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/sequential_access.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/sequential_access.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/sg_tree.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/sg_tree.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/sg_tree.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/skip_list.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/skip_list.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/skip_list.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/succinct_tree.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/succinct_tree.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/succinct_tree.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/top_k.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/top_k.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/top_k.cpp.o.d"
+  "/root/repo/tests/unit_tests/src/transactions.cpp" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/transactions.cpp.o" "gcc" "tests/unit_tests/CMakeFiles/unit_tests.dir/src/transactions.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
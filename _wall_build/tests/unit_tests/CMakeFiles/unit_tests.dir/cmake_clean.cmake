@@ -0,0 +1,64 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests.dir/src/adaptive_tree.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/adaptive_tree.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/buffered_tree.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/buffered_tree.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/cached_tree.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/cached_tree.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/checkpoint.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/checkpoint.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/combining_tree.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/combining_tree.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/details.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/details.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/end_node.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/end_node.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/erase.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/erase.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/export.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/export.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/fractional_cascade.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/fractional_cascade.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/heatmap.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/heatmap.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/iterators.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/iterators.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/kll_sketch.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/kll_sketch.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/lock_free_tree.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/lock_free_tree.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/main.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/main.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/merge_from.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/merge_from.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/order_statistics.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/order_statistics.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/packed_set.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/packed_set.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/rb_map.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/rb_map.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/rebuild.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/rebuild.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/relaxed_balance.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/relaxed_balance.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/sequential_access.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/sequential_access.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/sg_tree.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/sg_tree.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/skip_list.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/skip_list.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/succinct_tree.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/succinct_tree.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/top_k.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/top_k.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/src/transactions.cpp.o"
+  "CMakeFiles/unit_tests.dir/src/transactions.cpp.o.d"
+  "unit_tests"
+  "unit_tests.pdb"
+  "unit_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit_tests
+# Build directory: /root/repo/_wall_build/tests/unit_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_wall_build/tests/unit_tests/unit_tests[1]_include.cmake")
@@ -0,0 +1,259 @@
+#ifndef INCLUDE_ADAPTIVE_TREE_HPP
+#define INCLUDE_ADAPTIVE_TREE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+/*
+ * RB_Tree for workloads that alternate between writes and long read-only phases. After enough
+ * reads in a row the keys are copied into a sorted array in Eytzinger (BFS) order: the children
+ * of layout_[k] are layout_[2k] and layout_[2k + 1], so a search reads the array from the front,
+ * the top levels stay in cache and the loop has no unpredictable branches.
+ *
+ * The copy costs about as much as size() lookups in the tree, so it is started only after
+ * max (freeze_after, size()) reads in a row (ski rental): a read phase too short to pay it back
+ * spends at most twice as much as it would without it. The copy is made keys_per_read keys per
+ * read while the reads are still served by the tree, so no read waits for the whole conversion.
+ * The first write that changes the keys drops the copy, which takes O(1), and the tree serves
+ * everything again. contains() and lower_bound() use the copy; count_less() always goes to the tree.
+ *
+ * Not thread-safe, like RB_Tree: reads update the statistics and advance the conversion.
+ */
+template <typename Key_T>
+class Adaptive_Tree final
+{
+public:
+
+    using tree_type = RB_Tree<Key_T>;
+    using key_type = typename tree_type::key_type;
+    using size_type = typename tree_type::size_type;
+
+    static constexpr size_type default_freeze_after = 1024;
+    static constexpr size_type default_keys_per_read = 16;
+
+    enum class Representation
+    {
+        tree,     // reads and writes go to the tree
+        freezing, // the copy is being made, reads go to the tree
+        frozen    // lookups go to the copy
+    };
+
+private:
+
+    using const_iterator = typename tree_type::const_iterator;
+
+    tree_type tree_;
+
+    std::vector<key_type> layout_; // Eytzinger order from index 1, layout_[0] is unused
+    Representation representation_ = Representation::tree;
+
+    size_type freeze_after_;
+    size_type keys_per_read_;
+    size_type reads_since_write_ = 0;
+
+    // The next key to copy and its index in layout_
+    const_iterator next_key_;
+    size_type next_index_ = 0;
+
+    size_type n_freezes_ = 0;
+    size_type n_thaws_ = 0;
+
+public:
+
+    explicit Adaptive_Tree (size_type freeze_after = default_freeze_after,
+                            size_type keys_per_read = default_keys_per_read)
+        : freeze_after_{freeze_after}, keys_per_read_{keys_per_read}
+    {
+        assert (keys_per_read_ > 0);
+    }
+
+    // The conversion in progress refers to the tree it has been started for, so copies start thawed
+    Adaptive_Tree (const Adaptive_Tree &rhs)
+        : tree_{rhs.tree_}, freeze_after_{rhs.freeze_after_}, keys_per_read_{rhs.keys_per_read_} {}
+
+    Adaptive_Tree &operator= (const Adaptive_Tree &rhs)
+    {
+        auto tmp{rhs};
+        std::swap (*this, tmp);
+
+        return *this;
+    }
+
+    Adaptive_Tree (Adaptive_Tree &&rhs) = default;
+    Adaptive_Tree &operator= (Adaptive_Tree &&rhs) = default;
+
+    // Representation
+
+    Representation representation () const noexcept { return representation_; }
+    bool frozen () const noexcept { return representation_ == Representation::frozen; }
+
+    size_type n_freezes () const noexcept { return n_freezes_; }
+    size_type n_thaws () const noexcept { return n_thaws_; }
+
+    // Modifiers
+
+    // Returns false and leaves the keys unchanged if the key is already there
+    bool insert (const key_type &key)
+    {
+        auto inserted = tree_.insert (key).second;
+        on_write (inserted);
+
+        return inserted;
+    }
+
+    // Returns the number of erased keys: 0 or 1
+    size_type erase (const key_type &key)
+    {
+        auto n_erased = tree_.erase (key);
+        on_write (n_erased != 0);
+
+        return n_erased;
+    }
+
+    // Lookup
+
+    bool contains (const key_type &key)
+    {
+        on_read();
+
+        if (frozen())
+        {
+            auto k = search (key);
+            return k && !(key < layout_[k]);
+        }
+
+        return tree_.contains (key);
+    }
+
+    // The least key that is not less than key or nullopt if there is no such key
+    std::optional<key_type> lower_bound (const key_type &key)
+    {
+        on_read();
+
+        if (frozen())
+        {
+            auto k = search (key);
+            return k ? std::optional<key_type>{layout_[k]} : std::nullopt;
+        }
+
+        auto it = std::as_const (tree_).lower_bound (key);
+        return (it != tree_.end()) ? std::optional<key_type>{*it} : std::nullopt;
+    }
+
+    // Order statistics
+
+    size_type count_less (const key_type &key)
+    {
+        on_read();
+        return tree_.count_less (key);
+    }
+
+    // Capacity
+
+    size_type size () const { return tree_.size(); }
+    bool empty () const { return tree_.empty(); }
+
+    const tree_type &tree () const noexcept { return tree_; }
+
+private:
+
+    void on_write (bool changed)
+    {
+        reads_since_write_ = 0;
+
+        if (changed && representation_ != Representation::tree)
+        {
+            if (frozen())
+                n_thaws_++;
+
+            representation_ = Representation::tree;
+        }
+    }
+
+    void on_read ()
+    {
+        if (representation_ == Representation::tree &&
+            ++reads_since_write_ >= std::max (freeze_after_, tree_.size()))
+            start_freezing();
+
+        if (representation_ == Representation::freezing)
+            freeze_step();
+    }
+
+    // The memory of the previous copy is reused
+    void start_freezing ()
+    {
+        layout_.resize (tree_.size() + 1);
+
+        next_key_ = std::as_const (tree_).begin();
+        next_index_ = 1;
+        while (2 * next_index_ < layout_.size())
+            next_index_ *= 2;
+
+        representation_ = Representation::freezing;
+    }
+
+    // Keys are copied in ascending order, so they are placed in the in-order of the implicit tree
+    void freeze_step ()
+    {
+        for (size_type i = 0; i != keys_per_read_ && next_key_ != tree_.end(); ++i, ++next_key_)
+        {
+            layout_[next_index_] = *next_key_;
+            next_index_ = successor (next_index_);
+        }
+
+        if (next_key_ == tree_.end())
+        {
+            representation_ = Representation::frozen;
+            n_freezes_++;
+        }
+    }
+
+    // In-order successor of node k of the implicit tree or 0 if k is the last one
+    size_type successor (size_type k) const noexcept
+    {
+        auto n = layout_.size() - 1;
+
+        if (2 * k + 1 <= n)
+        {
+            k = 2 * k + 1;
+            while (2 * k <= n)
+                k *= 2;
+
+            return k;
+        }
+
+        // Climbs while k is a right child, then once more
+        return k >> (std::countr_one (k) + 1);
+    }
+
+    /*
+     * Index of the least key that is not less than key or 0 if there is no such key. The
+     * descent goes right on every key less than key and ends below a leaf; the last left turn
+     * is at the answer, and it is found by cancelling the right turns after it (Khuong, Morin).
+     */
+    size_type search (const key_type &key) const
+    {
+        auto n = layout_.size() - 1;
+
+        size_type k = 1;
+        while (k <= n)
+            k = 2 * k + (layout_[k] < key);
+
+        return k >> (std::countr_one (k) + 1);
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_ADAPTIVE_TREE_HPP
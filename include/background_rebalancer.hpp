@@ -0,0 +1,64 @@
+#ifndef INCLUDE_BACKGROUND_REBALANCER_HPP
+#define INCLUDE_BACKGROUND_REBALANCER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+/*
+ * Repairs violations of a tree in relaxed balancing mode from a separate thread. Every period
+ * the thread locks the mutex and calls rebalance_step (budget), so the mutex has to guard every
+ * other access to the tree as well, lookups included.
+ */
+template <typename Key_T>
+class Background_Rebalancer final
+{
+    using tree_type = RB_Tree<Key_T>;
+
+    tree_type &tree_;
+    std::mutex &mutex_;
+
+    std::size_t budget_;
+    std::chrono::microseconds period_;
+
+    std::condition_variable_any wakeup_;
+    std::jthread thread_;
+
+public:
+
+    Background_Rebalancer (tree_type &tree, std::mutex &mutex, std::size_t budget = 64,
+                           std::chrono::microseconds period = std::chrono::microseconds{100})
+        : tree_{tree}, mutex_{mutex}, budget_{budget}, period_{period},
+          thread_{[this](std::stop_token stop) { run (stop); }} {}
+
+    Background_Rebalancer (const Background_Rebalancer &rhs) = delete;
+    Background_Rebalancer &operator= (const Background_Rebalancer &rhs) = delete;
+
+    // Stops the thread. Violations that have not been repaired yet stay pending
+    ~Background_Rebalancer () = default;
+
+private:
+
+    void run (std::stop_token stop)
+    {
+        std::unique_lock lock{mutex_};
+
+        while (!stop.stop_requested())
+        {
+            tree_.rebalance_step (budget_);
+            wakeup_.wait_for (lock, stop, period_, []{ return false; });
+        }
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_BACKGROUND_REBALANCER_HPP
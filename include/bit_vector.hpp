@@ -0,0 +1,114 @@
+#ifndef INCLUDE_BIT_VECTOR_HPP
+#define INCLUDE_BIT_VECTOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace yLab
+{
+
+/*
+ * Immutable bit vector with rank and select. Besides the bits it keeps the number of ones
+ * before every block of 512 bits, which costs 1/8 bit per bit. rank1() takes O(1) time,
+ * select1() does a binary search over blocks and takes O(log n) time.
+ */
+class Bit_Vector final
+{
+public:
+
+    static constexpr std::size_t word_size = 64;
+    static constexpr std::size_t words_per_block = 8;
+
+private:
+
+    std::vector<std::uint64_t> words_;
+    std::vector<std::uint64_t> block_ranks_; // number of ones before each block
+    std::size_t size_ = 0;
+
+public:
+
+    Bit_Vector () = default;
+
+    explicit Bit_Vector (const std::vector<bool> &bits)
+        : words_((bits.size() + word_size - 1) / word_size), size_{bits.size()}
+    {
+        for (std::size_t i = 0; i != bits.size(); ++i)
+            if (bits[i])
+                words_[i / word_size] |= std::uint64_t{1} << (i % word_size);
+
+        block_ranks_.reserve (words_.size() / words_per_block + 2);
+
+        std::uint64_t rank = 0;
+        for (std::size_t i = 0; i != words_.size(); ++i)
+        {
+            if (i % words_per_block == 0)
+                block_ranks_.push_back (rank);
+            rank += std::popcount (words_[i]);
+        }
+        block_ranks_.push_back (rank); // total number of ones
+    }
+
+    std::size_t size () const noexcept { return size_; }
+    std::size_t n_ones () const noexcept { return block_ranks_.empty() ? 0 : block_ranks_.back(); }
+
+    std::size_t size_in_bytes () const noexcept
+    {
+        return words_.size() * sizeof (std::uint64_t) + block_ranks_.size() * sizeof (std::uint64_t);
+    }
+
+    bool operator[] (std::size_t i) const
+    {
+        assert (i < size_);
+        return (words_[i / word_size] >> (i % word_size)) & 1;
+    }
+
+    // Number of ones in [0, i)
+    std::size_t rank1 (std::size_t i) const
+    {
+        assert (i <= size_);
+
+        auto word_i = i / word_size;
+        std::size_t rank = block_ranks_[word_i / words_per_block];
+
+        for (auto w = word_i / words_per_block * words_per_block; w != word_i; ++w)
+            rank += std::popcount (words_[w]);
+
+        if (auto in_word = i % word_size)
+            rank += std::popcount (words_[word_i] & ((std::uint64_t{1} << in_word) - 1));
+
+        return rank;
+    }
+
+    // Position of the one with rank j (j starts from 0)
+    std::size_t select1 (std::size_t j) const
+    {
+        assert (j < n_ones());
+
+        // The last block that starts with at most j ones before it
+        auto block = std::upper_bound (block_ranks_.begin(), block_ranks_.end() - 1, j) - block_ranks_.begin() - 1;
+        auto left = j - block_ranks_[block];
+
+        auto word_i = static_cast<std::size_t>(block) * words_per_block;
+        for (;; ++word_i)
+        {
+            auto n_ones = static_cast<std::size_t>(std::popcount (words_[word_i]));
+            if (left < n_ones)
+                break;
+            left -= n_ones;
+        }
+
+        auto word = words_[word_i];
+        for (; left; --left)
+            word &= word - 1; // Clears the lowest one
+
+        return word_i * word_size + std::countr_zero (word);
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_BIT_VECTOR_HPP
@@ -0,0 +1,180 @@
+#ifndef INCLUDE_BUFFERED_TREE_HPP
+#define INCLUDE_BUFFERED_TREE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+/*
+ * Write buffer in front of RB_Tree. Insertions are appended to the buffer, which is merged into
+ * the tree once it holds merge_threshold keys (see RB_Tree::merge_from). The buffer is a sorted
+ * run followed by an unsorted tail of at most run_length keys; a full tail is sorted and merged
+ * into the run, so contains() costs a binary search plus a scan of the short tail.
+ *
+ * Only contains() checks both the buffer and the tree. Unlike an LSM lookup, the queries that
+ * return iterators or depend on the order of all keys (find, bounds, order statistics, size)
+ * merge the buffer first, because an iterator can only point into the tree.
+ */
+template <typename Key_T>
+class Buffered_Tree final
+{
+public:
+
+    using tree_type = RB_Tree<Key_T>;
+    using key_type = typename tree_type::key_type;
+    using value_type = typename tree_type::value_type;
+    using size_type = typename tree_type::size_type;
+    using iterator = typename tree_type::iterator;
+    using const_iterator = typename tree_type::const_iterator;
+
+    static constexpr size_type default_merge_threshold = 4096;
+    static constexpr size_type run_length = 64;
+
+private:
+
+    tree_type tree_;
+
+    // May contain duplicates and keys which are already in the tree.
+    // buffer_[0, sorted_) is sorted, buffer_[sorted_, size) is the unsorted tail
+    std::vector<key_type> buffer_;
+    size_type sorted_ = 0;
+    size_type merge_threshold_;
+
+    void sort_tail ()
+    {
+        auto middle = buffer_.begin() + sorted_;
+
+        std::sort (middle, buffer_.end());
+        std::inplace_merge (buffer_.begin(), middle, buffer_.end());
+        sorted_ = buffer_.size();
+    }
+
+public:
+
+    explicit Buffered_Tree (size_type merge_threshold = default_merge_threshold)
+        : merge_threshold_{std::max<size_type>(merge_threshold, 1)}
+    {
+        buffer_.reserve (merge_threshold_);
+    }
+
+    // Buffer
+
+    size_type merge_threshold () const noexcept { return merge_threshold_; }
+
+    void set_merge_threshold (size_type merge_threshold)
+    {
+        merge_threshold_ = std::max<size_type>(merge_threshold, 1);
+        if (buffer_.size() >= merge_threshold_)
+            merge();
+    }
+
+    size_type buffered () const noexcept { return buffer_.size(); }
+
+    void merge ()
+    {
+        if (buffer_.empty())
+            return;
+
+        sort_tail();
+        tree_.merge_from (buffer_);
+
+        buffer_.clear();
+        sorted_ = 0;
+    }
+
+    // Modifiers
+
+    void insert (const key_type &key)
+    {
+        buffer_.push_back (key);
+        if (buffer_.size() >= merge_threshold_)
+            merge();
+        else if (buffer_.size() - sorted_ >= run_length)
+            sort_tail();
+    }
+
+    template<std::input_iterator it>
+    void insert (it first, it last)
+    {
+        for (; first != last; ++first)
+            insert (*first);
+    }
+
+    // Lookup
+
+    bool contains (const key_type &key) const
+    {
+        if (tree_.contains (key))
+            return true;
+
+        auto middle = buffer_.begin() + sorted_;
+        return std::binary_search (buffer_.begin(), middle, key) ||
+               std::find (middle, buffer_.end(), key) != buffer_.end();
+    }
+
+    iterator find (const key_type &key)
+    {
+        merge();
+        return tree_.find (key);
+    }
+
+    iterator lower_bound (const key_type &key)
+    {
+        merge();
+        return tree_.lower_bound (key);
+    }
+
+    iterator upper_bound (const key_type &key)
+    {
+        merge();
+        return tree_.upper_bound (key);
+    }
+
+    iterator kth_smallest (size_type k)
+    {
+        merge();
+        return tree_.kth_smallest (k);
+    }
+
+    size_type count_less (const key_type &key)
+    {
+        merge();
+        return tree_.count_less (key);
+    }
+
+    // Capacity
+
+    size_type size ()
+    {
+        merge();
+        return tree_.size();
+    }
+
+    bool empty () const { return tree_.empty() && buffer_.empty(); }
+
+    // Iterators
+
+    iterator begin ()
+    {
+        merge();
+        return tree_.begin();
+    }
+
+    iterator end () { return tree_.end(); }
+
+    // Merges the buffer and gives access to the underlying tree
+    const tree_type &tree ()
+    {
+        merge();
+        return tree_;
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_BUFFERED_TREE_HPP
@@ -0,0 +1,210 @@
+#ifndef INCLUDE_CACHED_TREE_HPP
+#define INCLUDE_CACHED_TREE_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+struct Cache_Stats final
+{
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+
+    double hit_rate () const
+    {
+        auto n_lookups = hits + misses;
+        return n_lookups ? static_cast<double>(hits) / n_lookups : 0.0;
+    }
+};
+
+namespace details
+{
+
+// Remembers the last result of each query that maps to an entry, tagged with the version of
+// the tree it has been computed at
+template <typename Query_T, typename Result_T>
+class Direct_Mapped_Cache final
+{
+    struct Entry final
+    {
+        Query_T query{};
+        Result_T result{};
+        std::uint64_t tag = 0; // version + 1, 0 if the entry is empty
+    };
+
+    std::vector<Entry> entries_;
+
+public:
+
+    explicit Direct_Mapped_Cache (std::size_t n_entries)
+        : entries_(n_entries ? std::bit_ceil (n_entries) : 0) {}
+
+    std::size_t size () const noexcept { return entries_.size(); }
+
+    template <typename F>
+    Result_T get (const Query_T &query, std::uint64_t version, Cache_Stats &stats, F compute)
+    {
+        if (entries_.empty())
+            return compute();
+
+        auto &entry = entries_[index (query)];
+        if (entry.tag == version + 1 && entry.query == query)
+        {
+            stats.hits++;
+            return entry.result;
+        }
+
+        stats.misses++;
+        entry = {query, compute(), version + 1};
+
+        return entry.result;
+    }
+
+    void clear ()
+    {
+        for (auto &entry : entries_)
+            entry.tag = 0;
+    }
+
+private:
+
+    // std::hash is the identity for integers, so its bits are mixed before they are masked
+    std::size_t index (const Query_T &query) const
+    {
+        std::uint64_t hash = std::hash<Query_T>{}(query) * 0x9e3779b97f4a7c15;
+        return static_cast<std::size_t>(hash ^ (hash >> 32)) & (entries_.size() - 1);
+    }
+};
+
+} // namespace details
+
+/*
+ * RB_Tree with small direct-mapped caches of results of find(), count_less() and kth_smallest().
+ * A cached result is tagged with RB_Tree::version() and is returned without a descent while the
+ * version stays the same, so the cache pays off when the same queries are repeated between
+ * updates. A query that maps to an occupied entry replaces it.
+ *
+ * The tree may be modified directly through tree(): every change of keys bumps its version.
+ * With 0 entries the cache is disabled and queries go straight to the tree. Keys have to be
+ * hashable with std::hash and comparable with ==.
+ */
+template <typename Key_T>
+class Cached_Tree final
+{
+public:
+
+    using tree_type = RB_Tree<Key_T>;
+    using key_type = typename tree_type::key_type;
+    using value_type = typename tree_type::value_type;
+    using size_type = typename tree_type::size_type;
+    using const_iterator = typename tree_type::const_iterator;
+
+    static constexpr size_type default_n_entries = 1024;
+
+private:
+
+    tree_type tree_;
+
+    details::Direct_Mapped_Cache<key_type, const_iterator> find_cache_;
+    details::Direct_Mapped_Cache<key_type, size_type> rank_cache_;
+    details::Direct_Mapped_Cache<size_type, const_iterator> kth_cache_;
+
+    Cache_Stats stats_;
+
+public:
+
+    // n_entries is rounded up to a power of 2 for each kind of query
+    explicit Cached_Tree (size_type n_entries = default_n_entries)
+        : find_cache_{n_entries}, rank_cache_{n_entries}, kth_cache_{n_entries} {}
+
+    // Cached iterators point into the tree they have been computed for, so copies start empty
+    Cached_Tree (const Cached_Tree &rhs)
+        : tree_{rhs.tree_}, find_cache_{rhs.cache_size()}, rank_cache_{rhs.cache_size()},
+          kth_cache_{rhs.cache_size()} {}
+
+    Cached_Tree &operator= (const Cached_Tree &rhs)
+    {
+        auto tmp{rhs};
+        std::swap (*this, tmp);
+
+        return *this;
+    }
+
+    Cached_Tree (Cached_Tree &&rhs) = default;
+    Cached_Tree &operator= (Cached_Tree &&rhs) = default;
+
+    // Cache
+
+    size_type cache_size () const noexcept { return find_cache_.size(); }
+    bool cache_enabled () const noexcept { return cache_size() != 0; }
+
+    const Cache_Stats &stats () const noexcept { return stats_; }
+    void reset_stats () noexcept { stats_ = {}; }
+
+    void clear_cache ()
+    {
+        find_cache_.clear();
+        rank_cache_.clear();
+        kth_cache_.clear();
+    }
+
+    // Modifiers
+
+    std::pair<const_iterator, bool> insert (const key_type &key) { return tree_.insert (key); }
+
+    template<std::input_iterator it>
+    void insert (it first, it last) { tree_.insert (first, last); }
+
+    void insert (std::initializer_list<value_type> ilist) { tree_.insert (ilist); }
+
+    // Lookup
+
+    const_iterator find (const key_type &key)
+    {
+        return find_cache_.get (key, tree_.version(), stats_,
+                                [&]{ return std::as_const (tree_).find (key); });
+    }
+
+    bool contains (const key_type &key) { return find (key) != end(); }
+
+    // Order statistics
+
+    size_type count_less (const key_type &key)
+    {
+        return rank_cache_.get (key, tree_.version(), stats_,
+                                [&]{ return tree_.count_less (key); });
+    }
+
+    const_iterator kth_smallest (size_type k)
+    {
+        return kth_cache_.get (k, tree_.version(), stats_,
+                               [&]{ return std::as_const (tree_).kth_smallest (k); });
+    }
+
+    // Capacity
+
+    size_type size () const { return tree_.size(); }
+    bool empty () const { return tree_.empty(); }
+
+    // Iterators
+
+    const_iterator begin () const { return tree_.begin(); }
+    const_iterator end () const { return tree_.end(); }
+
+    tree_type &tree () noexcept { return tree_; }
+    const tree_type &tree () const noexcept { return tree_; }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_CACHED_TREE_HPP
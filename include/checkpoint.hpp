@@ -0,0 +1,157 @@
+#ifndef INCLUDE_CHECKPOINT_HPP
+#define INCLUDE_CHECKPOINT_HPP
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "rb_tree.hpp"
+#include "serialization.hpp"
+
+namespace yLab
+{
+
+struct Checkpoint_Report final
+{
+    bool succeeded;
+
+    std::chrono::duration<double> fork_time; // Time the caller was blocked in fork()
+    std::chrono::duration<double> elapsed;   // Time from fork() until the snapshot was written
+
+    // Minor page faults of the parent while the child was running. Most of them are pages
+    // copied on write, the rest are first touches of freshly allocated memory
+    long pages_copied;
+};
+
+/*
+ * Writes a snapshot of a tree to a file without blocking the caller for the time of writing.
+ * The process is forked, and the child serializes the tree as it was at the moment of fork(),
+ * while the parent keeps modifying it: the OS copies the pages the parent writes to.
+ * The snapshot is written to a temporary file, which is renamed to path when complete.
+ *
+ * The child only runs the serializer and exits, but it is still a copy of a possibly
+ * multithreaded process: other threads must not hold locks the serializer needs.
+ */
+class Checkpoint final
+{
+    using clock_type = std::chrono::steady_clock;
+
+    pid_t pid_ = -1;
+    clock_type::time_point start_;
+    std::chrono::duration<double> fork_time_{};
+    long start_minflt_ = 0;
+
+    bool finished_ = false;
+    Checkpoint_Report report_{};
+
+public:
+
+    template <typename Key_T>
+    Checkpoint (const RB_Tree<Key_T> &tree, const std::string &path)
+    {
+        start_minflt_ = minor_faults();
+        start_ = clock_type::now();
+
+        pid_ = ::fork();
+        if (pid_ == -1)
+            throw std::system_error{errno, std::generic_category(), "fork"};
+
+        if (pid_ == 0)
+            ::_exit (write_snapshot (tree, path) ? 0 : 1);
+
+        fork_time_ = clock_type::now() - start_;
+    }
+
+    Checkpoint (const Checkpoint &rhs) = delete;
+    Checkpoint &operator= (const Checkpoint &rhs) = delete;
+
+    Checkpoint (Checkpoint &&rhs) noexcept
+        : pid_{std::exchange (rhs.pid_, -1)}, start_{rhs.start_}, fork_time_{rhs.fork_time_},
+          start_minflt_{rhs.start_minflt_}, finished_{std::exchange (rhs.finished_, true)},
+          report_{rhs.report_} {}
+
+    Checkpoint &operator= (Checkpoint &&rhs) = delete;
+
+    ~Checkpoint ()
+    {
+        if (pid_ != -1 && !finished_)
+            wait();
+    }
+
+    // Does not block
+    bool done ()
+    {
+        if (!finished_)
+            reap (WNOHANG);
+
+        return finished_;
+    }
+
+    Checkpoint_Report wait ()
+    {
+        while (!finished_)
+            reap (0);
+
+        return report_;
+    }
+
+private:
+
+    static long minor_faults ()
+    {
+        rusage usage{};
+        ::getrusage (RUSAGE_SELF, &usage);
+
+        return usage.ru_minflt;
+    }
+
+    template <typename Key_T>
+    static bool write_snapshot (const RB_Tree<Key_T> &tree, const std::string &path)
+    {
+        auto tmp_path = path + ".tmp";
+
+        try
+        {
+            std::ofstream file{tmp_path, std::ios::binary | std::ios::trunc};
+            serialization::serialize (file, tree);
+
+            file.close();
+            if (!file)
+                return false;
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        return std::rename (tmp_path.c_str(), path.c_str()) == 0;
+    }
+
+    void reap (int options)
+    {
+        int status = 0;
+        auto pid = ::waitpid (pid_, &status, options);
+
+        if (pid == 0 || (pid == -1 && errno == EINTR))
+            return;
+
+        finished_ = true;
+        report_.succeeded = (pid == pid_) && WIFEXITED (status) && WEXITSTATUS (status) == 0;
+        report_.fork_time = fork_time_;
+        report_.elapsed = clock_type::now() - start_;
+        report_.pages_copied = minor_faults() - start_minflt_;
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_CHECKPOINT_HPP
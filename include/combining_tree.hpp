@@ -0,0 +1,227 @@
+#ifndef INCLUDE_COMBINING_TREE_HPP
+#define INCLUDE_COMBINING_TREE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+/*
+ * RB_Tree shared by many threads through flat combining (Hendler, Incze, Shavit, Tzafrir, 2010).
+ * A thread publishes its operation in a slot of its own and tries to lock the tree. The thread
+ * that succeeds becomes the combiner: it collects all published operations, sorts them by key,
+ * applies them in one pass and publishes their results. The others spin on their slots and on
+ * a flag that is set while a combiner works, and try the lock only when the flag is clear, so
+ * there is one lock handoff per batch instead of one per operation. Sorted insertions pass the
+ * previous result as a hint, and sorted lookups go through a cursor of the combiner (see
+ * RB_Tree::Cursor), so a batch walks the tree from left to right.
+ *
+ * Operations of one batch are concurrent, so any order among them is linearizable. A thread
+ * takes one of max_slots slots for the time of an operation; others wait for a slot.
+ */
+template <typename Key_T>
+class Combining_Tree final
+{
+public:
+
+    using tree_type = RB_Tree<Key_T>;
+    using key_type = typename tree_type::key_type;
+    using size_type = typename tree_type::size_type;
+
+    static constexpr std::size_t max_slots = 256;
+
+    // A combiner makes at most that many passes over the slots while it holds the lock
+    static constexpr unsigned max_passes = 4;
+
+private:
+
+    enum class Operation : std::uint8_t
+    {
+        insert,
+        erase,
+        contains
+    };
+
+    enum class State : std::uint8_t
+    {
+        free,    // not taken by a thread
+        taken,   // taken by a thread which has not published an operation yet
+        pending, // the operation is published
+        done     // the result is published
+    };
+
+    struct alignas (64) Slot final
+    {
+        std::atomic<State> state{State::free};
+        Operation operation;
+        bool result;
+        key_type key;
+    };
+
+    tree_type tree_;
+    std::mutex mutex_;
+    std::atomic<bool> combining_{false}; // set by the combiner while it holds mutex_
+
+    std::unique_ptr<Slot[]> slots_ = std::make_unique<Slot[]>(max_slots);
+    std::atomic<std::size_t> n_used_slots_{0}; // slots above it have never been taken
+
+    // Touched by the combiner only
+    std::vector<Slot *> batch_;
+    typename tree_type::Cursor cursor_;
+
+    // Written by the combiner only
+    std::atomic<std::size_t> n_batches_{0};
+    std::atomic<std::size_t> n_combined_{0};
+
+public:
+
+    Combining_Tree () { batch_.reserve (max_slots); }
+
+    Combining_Tree (const Combining_Tree &rhs) = delete;
+    Combining_Tree &operator= (const Combining_Tree &rhs) = delete;
+
+    // Modifiers
+
+    // Return false if the key is already there or is not there respectively
+    bool insert (const key_type &key) { return apply (Operation::insert, key); }
+    bool erase (const key_type &key) { return apply (Operation::erase, key); }
+
+    // Lookup
+
+    bool contains (const key_type &key) { return apply (Operation::contains, key); }
+
+    // Capacity
+
+    size_type size ()
+    {
+        std::lock_guard lock{mutex_};
+        return tree_.size();
+    }
+
+    // Statistics of combining, exact when no operation is in progress
+
+    size_type n_batches () const noexcept { return n_batches_.load (std::memory_order_relaxed); }
+    size_type n_combined () const noexcept { return n_combined_.load (std::memory_order_relaxed); }
+
+    // No operation may be in progress
+    tree_type &tree () noexcept { return tree_; }
+    const tree_type &tree () const noexcept { return tree_; }
+
+private:
+
+    bool apply (Operation operation, const key_type &key)
+    {
+        auto &slot = take_slot();
+
+        slot.operation = operation;
+        slot.key = key;
+        slot.state.store (State::pending, std::memory_order_release);
+
+        while (slot.state.load (std::memory_order_acquire) != State::done)
+        {
+            // The flag only keeps waiters off the lock; mutex_ orders the combiners
+            if (!combining_.load (std::memory_order_relaxed) && mutex_.try_lock())
+            {
+                combining_.store (true, std::memory_order_relaxed);
+                combine();
+                combining_.store (false, std::memory_order_relaxed);
+                mutex_.unlock();
+            }
+            else
+                std::this_thread::yield();
+        }
+
+        auto result = slot.result;
+        slot.state.store (State::free, std::memory_order_release);
+
+        return result;
+    }
+
+    Slot &take_slot ()
+    {
+        thread_local std::size_t hint = 0;
+
+        for (std::size_t i = hint, n_tries = 1;; i = (i + 1) % max_slots, ++n_tries)
+        {
+            auto &slot = slots_[i];
+
+            auto expected = State::free;
+            if (slot.state.load (std::memory_order_relaxed) == State::free &&
+                slot.state.compare_exchange_strong (expected, State::taken, std::memory_order_acquire))
+            {
+                hint = i;
+
+                auto n_used = n_used_slots_.load (std::memory_order_relaxed);
+                while (n_used <= i && !n_used_slots_.compare_exchange_weak (n_used, i + 1)) {}
+
+                return slot;
+            }
+
+            if (n_tries % max_slots == 0)
+                std::this_thread::yield();
+        }
+    }
+
+    void combine ()
+    {
+        for (unsigned pass = 0; pass != max_passes; ++pass)
+        {
+            batch_.clear();
+
+            for (std::size_t i = 0, n_used = n_used_slots_.load(); i != n_used; ++i)
+                if (slots_[i].state.load (std::memory_order_acquire) == State::pending)
+                    batch_.push_back (&slots_[i]);
+
+            if (batch_.empty())
+                return;
+
+            std::sort (batch_.begin(), batch_.end(),
+                       [](const Slot *lhs, const Slot *rhs) { return lhs->key < rhs->key; });
+
+            auto hint = tree_.cend();
+            for (auto slot : batch_)
+            {
+                switch (slot->operation)
+                {
+                    case Operation::insert:
+                    {
+                        auto size = tree_.size();
+                        hint = tree_.insert (hint, slot->key);
+                        slot->result = (tree_.size() != size);
+                        break;
+                    }
+
+                    case Operation::erase:
+                    {
+                        auto it = tree_.find (cursor_, slot->key);
+                        slot->result = (it != tree_.cend());
+                        hint = (slot->result) ? tree_.erase (it) : it;
+                        break;
+                    }
+
+                    case Operation::contains:
+                        slot->result = (tree_.find (cursor_, slot->key) != tree_.cend());
+                        break;
+                }
+
+                slot->state.store (State::done, std::memory_order_release);
+            }
+
+            n_batches_.fetch_add (1, std::memory_order_relaxed);
+            n_combined_.fetch_add (batch_.size(), std::memory_order_relaxed);
+        }
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_COMBINING_TREE_HPP
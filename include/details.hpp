@@ -1,10 +1,15 @@
 #ifndef INCLUDE_DETAILS_HPP
 #define INCLUDE_DETAILS_HPP
 
+#include <algorithm>
 #include <cassert>
+#include <concepts>
+#include <cstddef>
 #include <utility>
+#include <vector>
 
 #include "nodes.hpp"
+#include "probes.hpp"
 
 namespace yLab
 {
@@ -12,16 +17,80 @@ namespace yLab
 namespace details
 {
 
-template<typename Key_T>
-bool is_left_child (const RB_Node<Key_T> *node) noexcept
+// Node of a binary search tree linked to its parent that knows the size of its subtree
+template <typename Node_T>
+concept Tree_Node = requires (const Node_T &node)
+{
+    typename Node_T::key_type;
+    node.left_;
+    node.right_;
+    node.parent_;
+    node.size_;
+    node.key();
+};
+
+template <Tree_Node Node_T>
+bool is_left_child (const Node_T *node) noexcept
 {
     assert (node && node->parent_);
     
     return node == node->parent_->left_;
 }
 
-template<typename Key_T>
-const RB_Node<Key_T> *minimum (const RB_Node<Key_T> *node) noexcept
+template <Tree_Node Node_T>
+std::size_t size (const Node_T *node) noexcept
+{
+    return (node) ? node->size_ : 0;
+}
+
+/*
+ * Keys that carry data aggregated over their subtrees (e.g. Map_Entry of RB_Map) with lazy
+ * updates pending for the children. push() applies the pending update to the children, pull()
+ * recomputes the aggregate from the children. Both get nullptr for a missing child. The tree
+ * pushes before it changes the children of a node and pulls after that; keys are compared as
+ * usual, so the aggregated data has to be mutable.
+ */
+template <typename Key_T>
+concept Augmented_Key = requires (const Key_T &key, const Key_T *child)
+{
+    key.push (child, child);
+    key.pull (child, child);
+};
+
+template <Tree_Node Node_T>
+const typename Node_T::key_type *key_or_null (const Node_T *node) noexcept
+{
+    return (node) ? &node->key() : nullptr;
+}
+
+// Both do nothing unless the key of the node is Augmented_Key
+template <Tree_Node Node_T>
+void push (const Node_T *node)
+{
+    if constexpr (Augmented_Key<typename Node_T::key_type>)
+        if (node)
+            node->key().push (key_or_null (node->left_), key_or_null (node->right_));
+}
+
+template <Tree_Node Node_T>
+void pull (const Node_T *node)
+{
+    if constexpr (Augmented_Key<typename Node_T::key_type>)
+        if (node)
+            node->key().pull (key_or_null (node->left_), key_or_null (node->right_));
+}
+
+// Does nothing unless YLAB_COUNT_ACCESSES is defined
+template <Tree_Node Node_T>
+void count_access ([[maybe_unused]] const Node_T *node) noexcept
+{
+#ifdef YLAB_COUNT_ACCESSES
+    node->n_accesses_++;
+#endif
+}
+
+template <Tree_Node Node_T>
+const Node_T *minimum (const Node_T *node) noexcept
 {
     assert (node);
     
@@ -31,14 +100,14 @@ const RB_Node<Key_T> *minimum (const RB_Node<Key_T> *node) noexcept
     return node;
 }
 
-template<typename Key_T>
-RB_Node<Key_T> *minimum (RB_Node<Key_T> *node) noexcept
+template <Tree_Node Node_T>
+Node_T *minimum (Node_T *node) noexcept
 {
-    return const_cast<RB_Node<Key_T> *>(minimum (static_cast<const RB_Node<Key_T> *>(node)));
+    return const_cast<Node_T *>(minimum (static_cast<const Node_T *>(node)));
 }
 
-template<typename Key_T>
-const RB_Node<Key_T> *maximum (const RB_Node<Key_T> *node) noexcept
+template <Tree_Node Node_T>
+const Node_T *maximum (const Node_T *node) noexcept
 {
     assert (node);
     
@@ -48,14 +117,14 @@ const RB_Node<Key_T> *maximum (const RB_Node<Key_T> *node) noexcept
     return node;
 }
 
-template<typename Key_T>
-RB_Node<Key_T> *maximum (RB_Node<Key_T> *node) noexcept
+template <Tree_Node Node_T>
+Node_T *maximum (Node_T *node) noexcept
 {
-    return const_cast<RB_Node<Key_T> *>(maximum (static_cast<const RB_Node<Key_T> *>(node)));
+    return const_cast<Node_T *>(maximum (static_cast<const Node_T *>(node)));
 }
 
-template<typename Key_T>
-const RB_Node<Key_T> *successor (const RB_Node<Key_T> *node) noexcept
+template <Tree_Node Node_T>
+const Node_T *successor (const Node_T *node) noexcept
 {
     assert (node);
     
@@ -70,55 +139,61 @@ const RB_Node<Key_T> *successor (const RB_Node<Key_T> *node) noexcept
     return node->parent_;
 }
 
-template<typename Key_T>
-RB_Node<Key_T> *successor (RB_Node<Key_T> *node) noexcept
+template <Tree_Node Node_T>
+Node_T *successor (Node_T *node) noexcept
 {
-    return const_cast<RB_Node<Key_T> *>(successor (static_cast<const RB_Node<Key_T> *>(node)));
+    return const_cast<Node_T *>(successor (static_cast<const Node_T *>(node)));
 }
 
-template<typename Key_T>
-const RB_Node<Key_T> *predecessor (const RB_Node<Key_T> *node) noexcept
+template <Tree_Node Node_T>
+const Node_T *predecessor (const Node_T *node) noexcept
 {
     assert (node);
     
     if (node->left_)
         return maximum (node->left_);
 
-    auto parent = node->parent;
     while (is_left_child (node))
         node = node->parent_;
 
     return node->parent_;
 }
 
-template<typename Key_T>
-RB_Node<Key_T> *predecessor (RB_Node<Key_T> *node) noexcept
+template <Tree_Node Node_T>
+Node_T *predecessor (Node_T *node) noexcept
 {
-    return const_cast<RB_Node<Key_T> *>(prececessor (static_cast<const RB_Node<Key_T> *>(node)));
+    return const_cast<Node_T *>(predecessor (static_cast<const Node_T *>(node)));
 }
 
-template <typename Key_T>
-const RB_Node<Key_T> *find (const RB_Node<Key_T> *node, const Key_T &key)
+template <Tree_Node Node_T, typename Key_T>
+const Node_T *find (const Node_T *node, const Key_T &key)
 {
-    while (node && key != node->key())
+    while (node)
+    {
+        count_access (node);
+        if (key == node->key())
+            break;
+
         node = (key < node->key()) ? node->left_ : node->right_;
+    }
 
     return node;
 }
 
-template <typename Key_T>
-RB_Node<Key_T> *find (RB_Node<Key_T> *node, const Key_T &key)
+template <Tree_Node Node_T, typename Key_T>
+Node_T *find (Node_T *node, const Key_T &key)
 {
-    return const_cast<RB_Node<Key_T> *>(find (static_cast<const RB_Node<Key_T> *>(node), key));
+    return const_cast<Node_T *>(find (static_cast<const Node_T *>(node), key));
 }
 
 // Finds first element that is not less than key
-template <typename Key_T>
-const RB_Node<Key_T> *lower_bound (const RB_Node<Key_T> *node, const Key_T &key)
+template <Tree_Node Node_T, typename Key_T>
+const Node_T *lower_bound (const Node_T *node, const Key_T &key)
 {
-    const RB_Node<Key_T> *result = nullptr;
+    const Node_T *result = nullptr;
     while (node)
     {
+        count_access (node);
         if (key <= node->key())
         {
             result = node;
@@ -131,19 +206,20 @@ const RB_Node<Key_T> *lower_bound (const RB_Node<Key_T> *node, const Key_T &key)
     return result;
 }
 
-template <typename Key_T>
-RB_Node<Key_T> *lower_bound (RB_Node<Key_T> *node, const Key_T &key)
+template <Tree_Node Node_T, typename Key_T>
+Node_T *lower_bound (Node_T *node, const Key_T &key)
 {    
-    return const_cast<RB_Node<Key_T> *>(lower_bound (static_cast<const RB_Node<Key_T> *>(node), key));
+    return const_cast<Node_T *>(lower_bound (static_cast<const Node_T *>(node), key));
 }
 
 // Finds first element that is greater than key
-template <typename Key_T>
-const RB_Node<Key_T> *upper_bound (const RB_Node<Key_T> *node, const Key_T &key)
+template <Tree_Node Node_T, typename Key_T>
+const Node_T *upper_bound (const Node_T *node, const Key_T &key)
 {
-    const RB_Node<Key_T> *result = nullptr;
+    const Node_T *result = nullptr;
     while (node)
     {
+        count_access (node);
         if (key < node->key())
         {
             result = node;
@@ -156,16 +232,17 @@ const RB_Node<Key_T> *upper_bound (const RB_Node<Key_T> *node, const Key_T &key)
     return result;
 }
 
-template <typename Key_T>
-RB_Node<Key_T> *upper_bound (RB_Node<Key_T> *node, const Key_T &key)
+template <Tree_Node Node_T, typename Key_T>
+Node_T *upper_bound (Node_T *node, const Key_T &key)
 {
-    return const_cast<RB_Node<Key_T> *>(upper_bound (static_cast<const RB_Node<Key_T> *>(node), key));
+    return const_cast<Node_T *>(upper_bound (static_cast<const Node_T *>(node), key));
 }
 
 // (parent == nullptr) ==> (key == root().key())
 // (node != nullptr) ==> (parent != nullptr)
+// If rank is not nullptr, the number of elements of the subtree less than key is added to it
 template <typename Key_T>
-auto find_v2 (RB_Node<Key_T> *node, const Key_T &key)
+auto find_v2 (RB_Node<Key_T> *node, const Key_T &key, std::size_t *rank = nullptr)
 {
     using node_ptr = RB_Node<Key_T> *;
     using result = std::pair<node_ptr, node_ptr>;
@@ -174,23 +251,141 @@ auto find_v2 (RB_Node<Key_T> *node, const Key_T &key)
 
     while (node)
     {
+        count_access (node);
         if (key == node->key())
+        {
+            if (rank)
+                *rank += size (node->left_);
             return result{node, parent};
+        }
         
         parent = node;
-        node = (key < node->key()) ? node->left_ : node = node->right_;
+        if (key < node->key())
+            node = node->left_;
+        else
+        {
+            if (rank)
+                *rank += size (node->left_) + 1;
+            node = node->right_;
+        }
     }
 
     return result{node, parent};
 }
 
+// Finds k-th smallest element of the subtree (k starts from 0)
+template <Tree_Node Node_T>
+const Node_T *kth_smallest (const Node_T *node, std::size_t k)
+{
+    while (node)
+    {
+        count_access (node);
+        auto left_size = size (node->left_);
+
+        if (k < left_size)
+            node = node->left_;
+        else if (k == left_size)
+            return node;
+        else
+        {
+            k -= left_size + 1;
+            node = node->right_;
+        }
+    }
+
+    return nullptr;
+}
+
+template <Tree_Node Node_T>
+Node_T *kth_smallest (Node_T *node, std::size_t k)
+{
+    return const_cast<Node_T *>(kth_smallest (static_cast<const Node_T *>(node), k));
+}
+
+// Counts elements of the subtree that are less than key
+template <Tree_Node Node_T, typename Key_T>
+std::size_t count_less (const Node_T *node, const Key_T &key)
+{
+    std::size_t count = 0;
+    while (node)
+    {
+        count_access (node);
+        if (key <= node->key())
+            node = node->left_;
+        else
+        {
+            count += size (node->left_) + 1;
+            node = node->right_;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Climbs from node to the root of the smallest subtree that contains both node and the place
+ * of key, so that the search for key can start from there. Takes O(log d) steps, where d is
+ * the number of elements between key and node->key().
+ */
+template <typename Key_T>
+RB_Node<Key_T> *finger_climb (RB_Node<Key_T> *node, const Key_T &key, const RB_Node<Key_T> *root)
+{
+    assert (node && root);
+
+    if (key < node->key())
+    {
+        for (;;)
+        {
+            // Ancestors of a left child are greater than key
+            while (node != root && is_left_child (node))
+                node = node->parent_;
+
+            if (node == root)
+                return node;
+
+            auto parent = node->parent_;
+            if (parent->key() < key)
+                return node;
+            if (key == parent->key())
+                return parent;
+
+            node = parent;
+        }
+    }
+    else if (node->key() < key)
+    {
+        for (;;)
+        {
+            // Ancestors of a right child are less than key
+            while (node != root && !is_left_child (node))
+                node = node->parent_;
+
+            if (node == root)
+                return node;
+
+            auto parent = node->parent_;
+            if (key < parent->key())
+                return node;
+            if (key == parent->key())
+                return parent;
+
+            node = parent;
+        }
+    }
+
+    return node;
+}
+
 // Sometimes root_ can be affected. So it has to be changed if necessary
 template<typename Key_T>
 void left_rotate (RB_Node<Key_T> *x)
 {
     assert (x && x->right_);
-    
+    YLAB_PROBE (rotate__left, x);
+
     auto y = x->right_;
+    push (x);
+    push (y);
 
     x->right_ = y->left_;
     if (y->left_)
@@ -204,6 +399,12 @@ void left_rotate (RB_Node<Key_T> *x)
 
     y->left_ = x;
     x->parent_ = y;
+
+    y->size_ = x->size_;
+    x->size_ = size (x->left_) + size (x->right_) + 1;
+
+    pull (x);
+    pull (y);
 }
 
 // Sometimes root_ can be affected. So it has to be changed if necessary
@@ -211,8 +412,11 @@ template <typename Key_T>
 void right_rotate (RB_Node<Key_T> *x)
 {
     assert (x && x->left_);
+    YLAB_PROBE (rotate__right, x);
 
     auto y = x->left_;
+    push (x);
+    push (y);
 
     x->left_ = y->right_;
     if (y->right_)
@@ -226,46 +430,77 @@ void right_rotate (RB_Node<Key_T> *x)
 
     y->right_ = x;
     x->parent_ = y;
+
+    y->size_ = x->size_;
+    x->size_ = size (x->left_) + size (x->right_) + 1;
+
+    pull (x);
+    pull (y);
 }
 
-template <typename Key_T>
-auto fixup_subroutine_1 (RB_Node<Key_T> *new_node, RB_Node<Key_T> *uncle, const RB_Node<Key_T> *root)
+// Observer of the changes made by rb_insert_fixup() that ignores them. Another observer may be
+// passed to record the changes before they are made, e.g. to be able to undo them later
+struct No_Journal final
+{
+    template <typename Key_T>
+    void on_recolor (const RB_Node<Key_T> *) const noexcept {}
+
+    template <typename Key_T>
+    void on_left_rotate (const RB_Node<Key_T> *) const noexcept {}
+
+    template <typename Key_T>
+    void on_right_rotate (const RB_Node<Key_T> *) const noexcept {}
+};
+
+template <typename Key_T, typename Journal_T>
+void recolor (RB_Node<Key_T> *node, RB_Color color, Journal_T &journal)
+{
+    if (node->color_ != color)
+    {
+        journal.on_recolor (node);
+        node->color_ = color;
+    }
+}
+
+template <typename Key_T, typename Journal_T>
+auto fixup_subroutine_1 (RB_Node<Key_T> *new_node, RB_Node<Key_T> *uncle, const RB_Node<Key_T> *root,
+                         Journal_T &journal)
 {
     new_node = new_node->parent_;
-    new_node->color_ = RB_Color::black;
+    recolor (new_node, RB_Color::black, journal);
 
     new_node = new_node->parent_;
     if (new_node != root)
-        new_node->color_ = RB_Color::red;
+        recolor (new_node, RB_Color::red, journal);
 
-    uncle->color_ = RB_Color::black;
+    recolor (uncle, RB_Color::black, journal);
 
     return new_node;
 }
 
-template <typename Key_T>
-auto fixup_subroutine_2 (RB_Node<Key_T> *new_node)
+template <typename Key_T, typename Journal_T>
+auto fixup_subroutine_2 (RB_Node<Key_T> *new_node, Journal_T &journal)
 {
     new_node = new_node->parent_;
-    new_node->color_ = RB_Color::black;
+    recolor (new_node, RB_Color::black, journal);
 
     new_node = new_node->parent_;
-    new_node->color_ = RB_Color::red;
+    recolor (new_node, RB_Color::red, journal);
 
     return new_node;
 }
 
 // RB_invatiant (end_node_->left_) == true
 // But end_node_->left_ may be different than the value passed ad root
-template <typename Key_T>
-void rb_insert_fixup (const RB_Node<Key_T> *root, RB_Node<Key_T> *new_node)
+template <typename Key_T, typename Journal_T = No_Journal>
+void rb_insert_fixup (const RB_Node<Key_T> *root, RB_Node<Key_T> *new_node, Journal_T journal = {})
 {       
     assert (root && new_node);
     
     // Checks if "The root is black" property violated
     if (new_node == root)
     {
-        new_node->color_ = RB_Color::black;
+        recolor (new_node, RB_Color::black, journal);
         return;
     }
 
@@ -274,6 +509,8 @@ void rb_insert_fixup (const RB_Node<Key_T> *root, RB_Node<Key_T> *new_node)
     // Checks if "If a node is red, then both its children are black" property violated
     while (new_node != root && new_node->parent_->color_ == RB_Color::red)
     {
+        YLAB_PROBE (fixup__step, new_node);
+
         // First condition is important only for iterations 2, 3, ... but not for 1
         // (new_node->parent_->color_ == RB_Color::red) ==> (new_node->parent_ != root_)
         
@@ -283,16 +520,19 @@ void rb_insert_fixup (const RB_Node<Key_T> *root, RB_Node<Key_T> *new_node)
             RB_Node<Key_T> *uncle = new_node->parent_->parent_->right_;
 
             if (uncle && uncle->color_ == RB_Color::red)
-                new_node = fixup_subroutine_1 (new_node, uncle, root);
+                new_node = fixup_subroutine_1 (new_node, uncle, root, journal);
             else
             {
-                if (!is_left_child (new_node->parent_))
+                if (!is_left_child (new_node))
                 {
                     new_node = new_node->parent_;
+                    journal.on_left_rotate (new_node);
                     left_rotate (new_node);
                 }
 
-                right_rotate (fixup_subroutine_2 (new_node));
+                auto grandparent = fixup_subroutine_2 (new_node, journal);
+                journal.on_right_rotate (grandparent);
+                right_rotate (grandparent);
                 break;
             }
         }
@@ -302,22 +542,182 @@ void rb_insert_fixup (const RB_Node<Key_T> *root, RB_Node<Key_T> *new_node)
             RB_Node<Key_T> *uncle = new_node->parent_->parent_->left_;
 
             if (uncle && uncle->color_ == RB_Color::red)
-                new_node = fixup_subroutine_1 (new_node, uncle, root);
+                new_node = fixup_subroutine_1 (new_node, uncle, root, journal);
             else
             {
-                if (is_left_child (new_node->parent_))
+                if (is_left_child (new_node))
                 {
                     new_node = new_node->parent_;
+                    journal.on_right_rotate (new_node);
                     details::right_rotate (new_node);
                 }
 
-                left_rotate (fixup_subroutine_2 (new_node));
+                auto grandparent = fixup_subroutine_2 (new_node, journal);
+                journal.on_left_rotate (grandparent);
+                left_rotate (grandparent);
                 break;
             }
         }
     }
 }
 
+template <typename Key_T>
+bool is_black (const RB_Node<Key_T> *node) noexcept
+{
+    return node == nullptr || node->color_ == RB_Color::black;
+}
+
+// Restores red-black properties after a black node has been removed from the place that is
+// now taken by x (nullptr if it is a leaf), a child of parent. end is the parent of the root
+template <typename Key_T>
+void rb_erase_fixup (RB_Node<Key_T> *x, RB_Node<Key_T> *parent, const RB_Node<Key_T> *end)
+{
+    while (parent != end && is_black (x))
+    {
+        if (x == parent->left_)
+        {
+            auto sibling = parent->right_;
+
+            if (sibling->color_ == RB_Color::red)
+            {
+                sibling->color_ = RB_Color::black;
+                parent->color_ = RB_Color::red;
+                left_rotate (parent);
+                sibling = parent->right_;
+            }
+
+            if (is_black (sibling->left_) && is_black (sibling->right_))
+            {
+                sibling->color_ = RB_Color::red;
+                x = parent;
+                parent = x->parent_;
+            }
+            else
+            {
+                if (is_black (sibling->right_))
+                {
+                    sibling->left_->color_ = RB_Color::black;
+                    sibling->color_ = RB_Color::red;
+                    right_rotate (sibling);
+                    sibling = parent->right_;
+                }
+
+                sibling->color_ = parent->color_;
+                parent->color_ = RB_Color::black;
+                sibling->right_->color_ = RB_Color::black;
+                left_rotate (parent);
+                return;
+            }
+        }
+        else
+        {
+            auto sibling = parent->left_;
+
+            if (sibling->color_ == RB_Color::red)
+            {
+                sibling->color_ = RB_Color::black;
+                parent->color_ = RB_Color::red;
+                right_rotate (parent);
+                sibling = parent->left_;
+            }
+
+            if (is_black (sibling->left_) && is_black (sibling->right_))
+            {
+                sibling->color_ = RB_Color::red;
+                x = parent;
+                parent = x->parent_;
+            }
+            else
+            {
+                if (is_black (sibling->left_))
+                {
+                    sibling->right_->color_ = RB_Color::black;
+                    sibling->color_ = RB_Color::red;
+                    left_rotate (sibling);
+                    sibling = parent->left_;
+                }
+
+                sibling->color_ = parent->color_;
+                parent->color_ = RB_Color::black;
+                sibling->left_->color_ = RB_Color::black;
+                right_rotate (parent);
+                return;
+            }
+        }
+    }
+
+    if (x)
+        x->color_ = RB_Color::black;
+}
+
+// Links nodes[first, last), sorted by key, into a tree of minimal height and returns its root.
+// Nodes of RB_Node deeper than red_depth are colored red, the others black: if red_depth is
+// the number of full levels, the result is a valid red-black tree
+template <Tree_Node Node_T>
+Node_T *build_balanced (const std::vector<Node_T *> &nodes, std::size_t first, std::size_t last,
+                        std::size_t depth = 0, std::size_t red_depth = 0)
+{
+    if (first == last)
+        return nullptr;
+
+    auto middle = first + (last - first) / 2;
+    auto node = nodes[middle];
+
+    if constexpr (requires { node->color_; })
+        node->color_ = (depth >= red_depth) ? RB_Color::red : RB_Color::black;
+    node->size_ = last - first;
+
+    node->left_ = build_balanced (nodes, first, middle, depth + 1, red_depth);
+    if (node->left_)
+        node->left_->parent_ = node;
+
+    node->right_ = build_balanced (nodes, middle + 1, last, depth + 1, red_depth);
+    if (node->right_)
+        node->right_->parent_ = node;
+
+    pull (node);
+    return node;
+}
+
+/*
+ * Links nodes[first, last), sorted by key, into a nearly optimal binary search tree for the
+ * given access weights and returns its root (Mehlhorn's bisection rule). prefix[i] is the total
+ * weight of nodes[0, i). The root of each subtree is the node at which the weight of the subtree
+ * is split in halves, so a node of weight w lies not deeper than log2(W / w) + 1, where W is the
+ * total weight. Colors are not assigned.
+ */
+template <typename Key_T>
+RB_Node<Key_T> *build_weighted (const std::vector<RB_Node<Key_T> *> &nodes,
+                                const std::vector<std::size_t> &prefix,
+                                std::size_t first, std::size_t last)
+{
+    if (first == last)
+        return nullptr;
+
+    // The first i, such that weight of nodes[first, i) is at least half of weight of the subtree
+    auto total = prefix[last] - prefix[first];
+    auto half = std::partition_point (prefix.begin() + first + 1, prefix.begin() + last,
+                                      [&](std::size_t weight)
+                                      {
+                                          return 2 * (weight - prefix[first]) < total;
+                                      });
+    auto root_i = static_cast<std::size_t>(half - prefix.begin()) - 1;
+    auto node = nodes[root_i];
+
+    node->size_ = last - first;
+
+    node->left_ = build_weighted (nodes, prefix, first, root_i);
+    if (node->left_)
+        node->left_->parent_ = node;
+
+    node->right_ = build_weighted (nodes, prefix, root_i + 1, last);
+    if (node->right_)
+        node->right_->parent_ = node;
+
+    pull (node);
+    return node;
+}
+
 } // namespace details
 
 } // namespace yLab
@@ -0,0 +1,165 @@
+#ifndef INCLUDE_EPOCH_HPP
+#define INCLUDE_EPOCH_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace yLab
+{
+
+/*
+ * Epoch-based memory reclamation (Fraser, 2004). A thread pins the domain for the time it
+ * accesses shared nodes, announcing the global epoch it has observed. A node that has been
+ * unlinked is retired with the current epoch and reclaimed once the global epoch is two steps
+ * ahead: by then every thread that could have reached it has unpinned.
+ *
+ * Pinning takes one of max_slots slots, so the number of threads pinned at the same time is
+ * limited; others wait for a slot. Retired nodes belong to the slot, not to the thread.
+ */
+class Epoch_Domain final
+{
+public:
+
+    static constexpr std::size_t max_slots = 256;
+
+    // Number of retirements into a slot between attempts to advance the epoch
+    static constexpr std::size_t advance_period = 64;
+
+    using reclaim_type = void (*)(void *context, void *object);
+
+private:
+
+    struct Retired final
+    {
+        void *object;
+        reclaim_type reclaim;
+        void *context;
+        std::uint64_t epoch;
+    };
+
+    struct alignas (64) Slot final
+    {
+        std::atomic<bool> in_use{false};
+        std::atomic<std::uint64_t> epoch{0};
+
+        std::vector<Retired> retired;
+        std::size_t n_retired_since_advance = 0;
+    };
+
+    std::atomic<std::uint64_t> epoch_{0};
+    std::unique_ptr<Slot[]> slots_ = std::make_unique<Slot[]>(max_slots);
+
+public:
+
+    class Guard final
+    {
+        Epoch_Domain *domain_;
+        std::size_t slot_;
+
+        friend class Epoch_Domain;
+
+        Guard (Epoch_Domain *domain, std::size_t slot) : domain_{domain}, slot_{slot} {}
+
+    public:
+
+        Guard (const Guard &rhs) = delete;
+        Guard &operator= (const Guard &rhs) = delete;
+
+        ~Guard () { domain_->slots_[slot_].in_use.store (false, std::memory_order_release); }
+
+        // Index of the slot in [0, max_slots). It is owned by the guard until it is destroyed
+        std::size_t slot () const noexcept { return slot_; }
+    };
+
+    Epoch_Domain () = default;
+
+    Epoch_Domain (const Epoch_Domain &rhs) = delete;
+    Epoch_Domain &operator= (const Epoch_Domain &rhs) = delete;
+
+    // No guard may be alive
+    ~Epoch_Domain ()
+    {
+        for (std::size_t i = 0; i != max_slots; ++i)
+            for (auto &retired : slots_[i].retired)
+                retired.reclaim (retired.context, retired.object);
+    }
+
+    Guard pin ()
+    {
+        thread_local std::size_t hint = 0;
+
+        for (std::size_t i = hint, n_tries = 1;; i = (i + 1) % max_slots, ++n_tries)
+        {
+            auto &slot = slots_[i];
+
+            bool expected = false;
+            if (!slot.in_use.load (std::memory_order_relaxed) &&
+                slot.in_use.compare_exchange_strong (expected, true))
+            {
+                hint = i;
+                slot.epoch.store (epoch_.load());
+
+                return Guard{this, i};
+            }
+
+            if (n_tries % max_slots == 0)
+                std::this_thread::yield();
+        }
+    }
+
+    // The object has to be unreachable for threads that pin the domain after this call.
+    // reclaim(context, object) is called when no thread may access the object anymore
+    void retire (const Guard &guard, void *object, reclaim_type reclaim, void *context)
+    {
+        auto &slot = slots_[guard.slot()];
+        slot.retired.push_back ({object, reclaim, context, epoch_.load()});
+
+        if (++slot.n_retired_since_advance < advance_period)
+            return;
+
+        slot.n_retired_since_advance = 0;
+        try_advance();
+        collect (slot);
+    }
+
+    std::uint64_t epoch () const noexcept { return epoch_.load(); }
+
+private:
+
+    // The epoch advances when every pinned thread has observed the current one
+    void try_advance ()
+    {
+        auto current = epoch_.load();
+
+        for (std::size_t i = 0; i != max_slots; ++i)
+        {
+            auto &slot = slots_[i];
+            if (slot.in_use.load() && slot.epoch.load() != current)
+                return;
+        }
+
+        epoch_.compare_exchange_strong (current, current + 1);
+    }
+
+    void collect (Slot &slot)
+    {
+        auto current = epoch_.load();
+
+        std::erase_if (slot.retired, [current](const Retired &retired)
+        {
+            if (retired.epoch + 2 > current)
+                return false;
+
+            retired.reclaim (retired.context, retired.object);
+            return true;
+        });
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_EPOCH_HPP
@@ -0,0 +1,176 @@
+#ifndef INCLUDE_FRACTIONAL_CASCADE_HPP
+#define INCLUDE_FRACTIONAL_CASCADE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+/*
+ * Frozen copy of a family of RB_Trees (catalogs) that answers lower_bound and count_less in all
+ * of them at once with fractional cascading (Chazelle, Guibas, 1986).
+ *
+ * Catalog i is augmented with every other key of augmented catalog i + 1. Each augmented key
+ * remembers its lower bound in its own catalog and in the next augmented catalog. A query does
+ * one binary search in the first augmented catalog and then steps at most one position back in
+ * each of the following ones, so it costs O(log n + k) instead of O(k log n). The augmented
+ * catalogs hold at most twice as many keys as the original ones.
+ */
+template <typename Key_T>
+class Fractional_Cascade final
+{
+public:
+
+    using tree_type = RB_Tree<Key_T>;
+    using key_type = Key_T;
+    using size_type = std::size_t;
+    using catalog_type = std::vector<key_type>;
+    using const_iterator = typename catalog_type::const_iterator;
+
+private:
+
+    struct Bridge final
+    {
+        size_type own;  // lower bound of the key in the catalog
+        size_type next; // lower bound of the key in the next augmented catalog
+    };
+
+    struct Level final
+    {
+        std::vector<key_type> keys;  // augmented catalog
+        std::vector<Bridge> bridges; // one per key and one past the last key
+    };
+
+    std::vector<catalog_type> catalogs_;
+    std::vector<Level> levels_;
+
+public:
+
+    template <std::ranges::input_range Trees>
+    requires std::same_as<std::ranges::range_value_t<Trees>, tree_type>
+    explicit Fractional_Cascade (const Trees &trees)
+    {
+        for (auto &tree : trees)
+            catalogs_.emplace_back (tree.begin(), tree.end());
+
+        levels_.resize (catalogs_.size());
+        for (auto i = catalogs_.size(); i-- != 0;)
+            build_level (i);
+    }
+
+    size_type n_catalogs () const noexcept { return catalogs_.size(); }
+
+    const catalog_type &catalog (size_type i) const
+    {
+        assert (i < catalogs_.size());
+        return catalogs_[i];
+    }
+
+    // Writes the number of keys less than key in catalog i to ranks[i]
+    void count_less (const key_type &key, std::span<size_type> ranks) const
+    {
+        assert (ranks.size() >= catalogs_.size());
+
+        if (levels_.empty())
+            return;
+
+        auto &first_keys = levels_.front().keys;
+        auto pos = static_cast<size_type>(std::lower_bound (first_keys.begin(), first_keys.end(), key)
+                                          - first_keys.begin());
+
+        for (size_type i = 0; i != levels_.size(); ++i)
+        {
+            auto &bridge = levels_[i].bridges[pos];
+            ranks[i] = bridge.own;
+
+            if (i + 1 == levels_.size())
+                break;
+
+            // Keys between two neighbouring keys of this level are not sampled into it,
+            // hence there is at most one of them
+            auto &next_keys = levels_[i + 1].keys;
+            pos = bridge.next;
+            while (pos != 0 && !(next_keys[pos - 1] < key))
+                pos--;
+        }
+    }
+
+    std::vector<size_type> count_less (const key_type &key) const
+    {
+        std::vector<size_type> ranks (catalogs_.size());
+        count_less (key, ranks);
+
+        return ranks;
+    }
+
+    // Lower bound of key in every catalog; catalog(i).end() if there is none in catalog i
+    std::vector<const_iterator> lower_bound (const key_type &key) const
+    {
+        auto ranks = count_less (key);
+
+        std::vector<const_iterator> bounds;
+        bounds.reserve (catalogs_.size());
+        for (size_type i = 0; i != catalogs_.size(); ++i)
+            bounds.push_back (catalogs_[i].begin() + ranks[i]);
+
+        return bounds;
+    }
+
+private:
+
+    void build_level (size_type i)
+    {
+        auto &catalog = catalogs_[i];
+        auto &level = levels_[i];
+
+        if (i + 1 == levels_.size())
+        {
+            level.keys = catalog;
+            level.bridges.resize (catalog.size() + 1);
+            for (size_type j = 0; j <= catalog.size(); ++j)
+                level.bridges[j] = Bridge{j, 0};
+
+            return;
+        }
+
+        auto &next_keys = levels_[i + 1].keys;
+
+        // Every other key of the next level, starting from the second one
+        std::vector<key_type> sample;
+        sample.reserve (next_keys.size() / 2);
+        for (size_type j = 1; j < next_keys.size(); j += 2)
+            sample.push_back (next_keys[j]);
+
+        level.keys.reserve (catalog.size() + sample.size());
+        std::merge (catalog.begin(), catalog.end(), sample.begin(), sample.end(),
+                    std::back_inserter (level.keys));
+
+        level.bridges.resize (level.keys.size() + 1);
+
+        size_type own = 0, next = 0;
+        for (size_type j = 0; j != level.keys.size(); ++j)
+        {
+            auto &key = level.keys[j];
+            while (own != catalog.size() && catalog[own] < key)
+                own++;
+            while (next != next_keys.size() && next_keys[next] < key)
+                next++;
+
+            level.bridges[j] = Bridge{own, next};
+        }
+
+        level.bridges.back() = Bridge{catalog.size(), next_keys.size()};
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_FRACTIONAL_CASCADE_HPP
@@ -3,6 +3,15 @@
 
 #include <fstream>
 
+#ifdef YLAB_COUNT_ACCESSES
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#endif
+
 #include "rb_tree.hpp"
 
 namespace yLab
@@ -74,6 +83,99 @@ void tree_dump (std::ostream &fs, typename RB_Tree<Key_T>::iterator begin,
     fs << "\tnode_" << end.base() << " -> node_" << end.base()->left_ << " [color = \"blue\"];\n}\n";
 }
 
+#ifdef YLAB_COUNT_ACCESSES
+
+// Maps number of accesses to a color from blue (cold) to red (hot). The scale is logarithmic
+// because the number of accesses decreases roughly exponentially with depth
+inline void heat_color_dump (std::ostream &fs, std::size_t n_accesses, std::size_t max_n_accesses)
+{
+    auto heat = (max_n_accesses == 0) ? 0.0
+                                      : std::log1p (static_cast<double>(n_accesses)) /
+                                        std::log1p (static_cast<double>(max_n_accesses));
+
+    char color[32];
+    std::snprintf (color, sizeof (color), "%.3f 0.85 1.000", (1.0 - heat) * 0.666);
+    fs << "\"" << color << "\"";
+}
+
+/*
+ * Dumps only the nodes that lie on the n_paths hottest paths, i.e. on the paths from the root
+ * to the nodes where the greatest number of descents stopped. Nodes are colored by the number
+ * of descents that passed through them and annotated with their depth and subtree size.
+ * Subtrees that are left out are collapsed into a single node showing their size.
+ */
+template<typename Key_T>
+void heatmap_dump (std::ostream &fs, typename RB_Tree<Key_T>::iterator begin,
+                                     typename RB_Tree<Key_T>::iterator end, std::size_t n_paths)
+{
+    using rb_node_ptr = decltype (end.base());
+
+    auto n_accesses = [](rb_node_ptr node) { return (node) ? node->n_accesses_ : 0; };
+
+    // Rotations move nodes after they were counted, so children may have more accesses than
+    // their parent has
+    std::vector<std::pair<std::size_t, rb_node_ptr>> stops;
+    for (auto it = begin; it != end; ++it)
+    {
+        auto node = it.base();
+        auto passed = n_accesses (node->left_) + n_accesses (node->right_);
+        stops.emplace_back ((node->n_accesses_ > passed) ? node->n_accesses_ - passed : 0, node);
+    }
+
+    n_paths = std::min (n_paths, stops.size());
+    std::partial_sort (stops.begin(), stops.begin() + n_paths, stops.end(),
+                       [](const auto &lhs, const auto &rhs) { return lhs.first > rhs.first; });
+
+    std::unordered_set<rb_node_ptr> shown;
+    for (std::size_t i = 0; i != n_paths; ++i)
+        for (auto node = stops[i].second; node != end.base() && shown.insert (node).second;
+             node = node->parent_) {}
+
+    fs << "digraph Heatmap\n"
+          "{\n"
+          "\trankdir = TB;\n"
+          "\tnode [style = filled, shape = box];\n\n";
+
+    auto root = end.base()->left_;
+    auto max_n_accesses = n_accesses (root);
+
+    for (auto it = begin; it != end; ++it)
+    {
+        auto node = it.base();
+        if (!shown.contains (node))
+            continue;
+
+        std::size_t depth = 0;
+        for (auto ancestor = node; ancestor != root; ancestor = ancestor->parent_)
+            depth++;
+
+        fs << "\tnode_" << node << " [fillcolor = ";
+        heat_color_dump (fs, node->n_accesses_, max_n_accesses);
+        fs << ", color = " << ((node->color_ == RB_Color::black) ? "black" : "red")
+           << ", label = \"" << node->key() << "\\naccesses: " << node->n_accesses_
+           << "\\ndepth: " << depth << "\\nsize: " << node->size_ << "\"];\n";
+
+        for (auto child : {node->left_, node->right_})
+        {
+            if (child == nullptr)
+                continue;
+
+            if (shown.contains (child))
+                fs << "\tnode_" << node << " -> node_" << child << ";\n";
+            else
+            {
+                fs << "\tcollapsed_" << child << " [shape = plaintext, style = \"\", label = \"("
+                   << child->size_ << " more)\"];\n"
+                      "\tnode_" << node << " -> collapsed_" << child << " [style = dashed];\n";
+            }
+        }
+    }
+
+    fs << "}\n";
+}
+
+#endif // YLAB_COUNT_ACCESSES
+
 } // namespace graphic_dump
 
 } // namespace yLab
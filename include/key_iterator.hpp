@@ -0,0 +1,63 @@
+#ifndef INCLUDE_KEY_ITERATOR_HPP
+#define INCLUDE_KEY_ITERATOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace yLab
+{
+
+/*
+ * Iterator over a concurrent container. It holds a copy of the key rather than a pointer to a
+ * node, which may be reclaimed at any moment, and asks the container for the next key on
+ * increment. Container_T::next_key(key) has to return the least key greater than key or
+ * std::nullopt.
+ */
+template <typename Container_T>
+class key_iterator final
+{
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename Container_T::key_type;
+    using reference = const value_type &;
+    using pointer = const value_type *;
+
+private:
+
+    using self = key_iterator;
+
+    const Container_T *container_ = nullptr;
+    std::optional<value_type> key_; // empty for end()
+
+public:
+
+    key_iterator () = default;
+    key_iterator (const Container_T *container, std::optional<value_type> key)
+        : container_{container}, key_{std::move (key)} {}
+
+    reference operator* () const { return *key_; }
+    pointer operator-> () const { return &*key_; }
+
+    self &operator++ ()
+    {
+        key_ = container_->next_key (*key_);
+        return *this;
+    }
+
+    self operator++ (int)
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool operator== (const self &rhs) const { return key_ == rhs.key_; }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_KEY_ITERATOR_HPP
@@ -0,0 +1,229 @@
+#ifndef INCLUDE_KLL_SKETCH_HPP
+#define INCLUDE_KLL_SKETCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace yLab
+{
+
+/*
+ * Approximate order statistics of a stream in bounded memory (Karnin, Lang, Liberty, 2016).
+ * The sketch keeps a hierarchy of compactors: an item on level h stands for 2^h items of the
+ * stream. When a level is full, it is sorted and every other item (starting from a random one)
+ * is promoted to the next level, the rest are dropped. Capacities decrease geometrically towards
+ * lower levels, so the sketch keeps about 3 * k items no matter how long the stream is.
+ *
+ * count_less() and kth_smallest() mirror the exact RB_Tree ones and are off by about
+ * normalized_rank_error() * size() positions. Sketches built over different parts of a stream
+ * (e.g. in different threads) may be merged.
+ */
+template <typename Key_T>
+class KLL_Sketch final
+{
+public:
+
+    using key_type = Key_T;
+    using size_type = std::size_t;
+
+    static constexpr size_type default_k = 200;
+    static constexpr size_type min_k = 8;
+
+private:
+
+    using self = KLL_Sketch<Key_T>;
+
+    static constexpr double capacity_ratio = 2.0 / 3.0;
+
+    size_type k_;
+    size_type size_ = 0;       // Number of items in the stream
+    size_type n_retained_ = 0; // Number of items in compactors
+    size_type max_retained_ = 0;
+
+    std::vector<std::vector<key_type>> compactors_;
+    std::minstd_rand gen_;
+
+public:
+
+    explicit KLL_Sketch (size_type k = default_k, std::uint_fast32_t seed = std::minstd_rand::default_seed)
+        : k_{std::max (k, min_k)}, gen_{seed}
+    {
+        grow();
+    }
+
+    // Empirical estimate of the rank error, relative to size(), that holds with 99% confidence
+    static double normalized_rank_error (size_type k) { return 2.296 / std::pow (k, 0.9723); }
+    double normalized_rank_error () const { return normalized_rank_error (k_); }
+
+    size_type k () const noexcept { return k_; }
+    size_type size () const noexcept { return size_; }
+    bool empty () const noexcept { return size_ == 0; }
+
+    // Number of items kept in memory
+    size_type n_retained () const noexcept { return n_retained_; }
+
+    void insert (const key_type &key)
+    {
+        compactors_.front().push_back (key);
+        size_++;
+        n_retained_++;
+
+        if (n_retained_ >= max_retained_)
+            compress();
+    }
+
+    template<std::input_iterator it>
+    void insert (it first, it last)
+    {
+        for (; first != last; ++first)
+            insert (*first);
+    }
+
+    void merge (const self &other)
+    {
+        // Appending a compactor to itself would read a range that the insertion invalidates
+        if (&other == this)
+        {
+            auto copy = other;
+            merge (copy);
+            return;
+        }
+
+        while (compactors_.size() < other.compactors_.size())
+            grow();
+
+        for (std::size_t h = 0; h != other.compactors_.size(); ++h)
+            compactors_[h].insert (compactors_[h].end(), other.compactors_[h].begin(),
+                                   other.compactors_[h].end());
+
+        size_ += other.size_;
+        n_retained_ += other.n_retained_;
+
+        while (n_retained_ >= max_retained_)
+            compress();
+    }
+
+    // Estimated number of items that are less than key
+    size_type count_less (const key_type &key) const
+    {
+        size_type count = 0;
+        for (std::size_t h = 0; h != compactors_.size(); ++h)
+        {
+            auto &items = compactors_[h];
+            auto n_less = std::count_if (items.begin(), items.end(),
+                                         [&key](const key_type &item) { return item < key; });
+            count += static_cast<size_type>(n_less) << h;
+        }
+
+        return count;
+    }
+
+    // Estimated k-th smallest item (k starts from 0) or nullopt if the sketch is empty
+    std::optional<key_type> kth_smallest (size_type k) const
+    {
+        if (empty())
+            return std::nullopt;
+
+        auto items = weighted_items();
+
+        size_type rank = 0;
+        for (auto &[item, weight] : items)
+        {
+            rank += weight;
+            if (k < rank)
+                return item;
+        }
+
+        return items.back().first;
+    }
+
+    // Estimated item, such that fraction q of the stream is less than it, or nullopt if the
+    // sketch is empty
+    std::optional<key_type> quantile (double q) const
+    {
+        if (empty())
+            return std::nullopt;
+
+        q = std::clamp (q, 0.0, 1.0);
+        return kth_smallest (std::min (static_cast<size_type>(q * size_), size_ - 1));
+    }
+
+private:
+
+    size_type capacity (std::size_t h) const
+    {
+        auto depth = compactors_.size() - h - 1;
+        return static_cast<size_type>(std::ceil (std::pow (capacity_ratio, depth) * k_)) + 1;
+    }
+
+    void grow ()
+    {
+        compactors_.emplace_back();
+
+        max_retained_ = 0;
+        for (std::size_t h = 0; h != compactors_.size(); ++h)
+            max_retained_ += capacity (h);
+    }
+
+    // Compacts the lowest level that is full
+    void compress ()
+    {
+        for (std::size_t h = 0; h != compactors_.size(); ++h)
+        {
+            if (compactors_[h].size() < capacity (h))
+                continue;
+
+            if (h + 1 == compactors_.size())
+                grow();
+
+            auto &items = compactors_[h];
+            std::sort (items.begin(), items.end());
+
+            // An odd item stays on its level
+            std::vector<key_type> rest;
+            if (items.size() % 2)
+            {
+                rest.push_back (std::move (items.back()));
+                items.pop_back();
+            }
+
+            auto &next = compactors_[h + 1];
+            for (auto i = std::uniform_int_distribution<std::size_t>{0, 1}(gen_); i < items.size(); i += 2)
+                next.push_back (std::move (items[i]));
+
+            n_retained_ -= items.size() / 2;
+            items = std::move (rest);
+
+            return;
+        }
+    }
+
+    // Retained items in ascending order together with the number of stream items they stand for
+    std::vector<std::pair<key_type, size_type>> weighted_items () const
+    {
+        std::vector<std::pair<key_type, size_type>> items;
+        items.reserve (n_retained_);
+
+        for (std::size_t h = 0; h != compactors_.size(); ++h)
+            for (auto &item : compactors_[h])
+                items.emplace_back (item, size_type{1} << h);
+
+        std::sort (items.begin(), items.end(), [](const auto &lhs, const auto &rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+
+        return items;
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_KLL_SKETCH_HPP
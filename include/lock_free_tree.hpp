@@ -0,0 +1,842 @@
+#ifndef INCLUDE_LOCK_FREE_TREE_HPP
+#define INCLUDE_LOCK_FREE_TREE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "epoch.hpp"
+#include "key_iterator.hpp"
+#include "node_arena.hpp"
+
+namespace yLab
+{
+
+namespace details
+{
+
+template <typename Key_T>
+struct LF_Record;
+
+// Node of an external search tree: keys are stored in leaves, internal nodes only route
+// searches. Everything but the children of internal nodes is immutable: a node that changes
+// its weight is replaced with a copy
+template <typename Key_T>
+struct LF_Node final
+{
+    Key_T key_;
+    std::uint8_t inf_;      // 0 for keys, 1 and 2 for sentinels greater than every key
+    std::uint16_t home_;    // slot of the arena the node has been created in
+    std::uint32_t weight_;  // 0 for red nodes, 1 for black ones, more for overweight ones
+
+    std::atomic<LF_Node *> child_[2]{}; // null for leaves
+
+    // The last SCX that has frozen the node and whether it has removed the node from the tree
+    std::atomic<LF_Record<Key_T> *> info_;
+    std::atomic<bool> marked_{false};
+
+    LF_Node (const Key_T &key, std::uint8_t inf, std::uint16_t home, std::uint32_t weight,
+             LF_Record<Key_T> *info)
+        : key_{key}, inf_{inf}, home_{home}, weight_{weight}, info_{info} {}
+};
+
+// Descriptor of an SCX: it changes one child of v_[0] from old_child_ to new_child_ if none of
+// v_ has changed since it has been read by LLX, and removes r_ from the tree
+template <typename Key_T>
+struct LF_Record final
+{
+    enum class State : std::uint8_t { in_progress, committed, aborted };
+
+    static constexpr std::size_t max_nodes = 5;
+
+    std::atomic<State> state_{State::in_progress};
+    std::atomic<bool> all_frozen_{false};
+
+    // Nodes whose info_ points to the record, and one more for the thread that has created it
+    std::atomic<std::ptrdiff_t> n_refs_{0};
+
+    std::size_t n_v_ = 0;
+    std::size_t n_r_ = 0;
+    LF_Node<Key_T> *v_[max_nodes];
+    LF_Record *infos_[max_nodes]; // info_ of v_[i] seen by LLX
+    LF_Node<Key_T> *r_[max_nodes];
+
+    std::atomic<LF_Node<Key_T> *> *field_ = nullptr;
+    LF_Node<Key_T> *old_child_ = nullptr;
+    LF_Node<Key_T> *new_child_ = nullptr;
+};
+
+} // namespace details
+
+/*
+ * Non-blocking balanced set: a chromatic tree (Nurmi, Soisalon-Soininen, 1996) built on the
+ * LLX and SCX primitives (Brown, Ellen, Ruppert, 2014). It is an external search tree whose
+ * nodes carry weights instead of colours: a path from the root to a leaf has the same total
+ * weight through any leaf, and the tree is a red-black tree once no node is overweight (weight
+ * greater than 1) and no red node (weight 0) has a red parent.
+ *
+ * insert() and erase() replace a few nodes at the bottom of the tree by one SCX and may leave
+ * a violation of these two rules on the search path of their key. Before returning, the thread
+ * walks down that path again and repairs every violation it meets by one of the rebalancing
+ * steps of the chromatic tree, each of which is a single SCX as well, so the height stays
+ * O(log n + c) for c concurrent updates even on sorted input. An SCX freezes the nodes it is
+ * about to change; threads that meet a frozen node help to finish the SCX, so insert(), erase()
+ * and lookups may be called concurrently from any number of threads without locks.
+ *
+ * Nodes are created in per-slot Node_Arenas (see Epoch_Domain) and reclaimed through epoch-based
+ * reclamation, so a node is never destroyed while another thread may read it. Memory of a node
+ * is reused by the arena it has been created in. SCX descriptors count the nodes that point to
+ * them and are retired when the count drops to zero.
+ *
+ * Iterators hold a copy of a key (see key_iterator), so they stay valid while the tree changes.
+ * Iteration and size() are weakly consistent: they reflect some of the concurrent modifications.
+ */
+template <typename Key_T>
+class Lock_Free_Tree final
+{
+public:
+
+    using key_type = Key_T;
+    using value_type = key_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using node_type = details::LF_Node<key_type>;
+
+    using const_iterator = key_iterator<Lock_Free_Tree>;
+    using iterator = const_iterator;
+
+private:
+
+    using self = Lock_Free_Tree<key_type>;
+    using node_ptr = node_type *;
+    using record_type = details::LF_Record<key_type>;
+    using record_ptr = record_type *;
+    using State = typename record_type::State;
+    using Guard = Epoch_Domain::Guard;
+
+    friend const_iterator;
+
+    struct alignas (64) Slot_State final
+    {
+        Node_Arena<node_type> arena;
+
+        // Nodes of the arena reclaimed by other slots, linked through their left children
+        std::atomic<node_ptr> remote_free{nullptr};
+
+        std::atomic<std::ptrdiff_t> size_delta{0};
+    };
+
+    // Children of a node read by LLX together with the info_ they have been read under
+    struct Snapshot final
+    {
+        node_ptr node;
+        record_ptr info;
+        node_ptr child[2];
+    };
+
+    // Nodes created for one SCX. They are destroyed unless the SCX succeeds
+    class New_Nodes final
+    {
+        self *tree_;
+        std::size_t slot_;
+
+        std::array<node_ptr, 4> nodes_;
+        std::size_t size_ = 0;
+
+    public:
+
+        New_Nodes (self *tree, std::size_t slot) : tree_{tree}, slot_{slot} {}
+
+        New_Nodes (const New_Nodes &rhs) = delete;
+        New_Nodes &operator= (const New_Nodes &rhs) = delete;
+
+        ~New_Nodes ()
+        {
+            for (std::size_t i = 0; i != size_; ++i)
+                tree_->slots_[slot_].arena.destroy (nodes_[i]);
+        }
+
+        node_ptr leaf (const key_type &key, std::uint8_t inf)
+        {
+            return nodes_[size_++] = tree_->create (slot_, key, inf, 1);
+        }
+
+        // Copy of like->key_ with the given weight and children: child_[dir] is toward and
+        // the other one is away
+        node_ptr copy (const node_type *like, std::uint32_t weight, std::size_t dir,
+                       node_ptr toward, node_ptr away)
+        {
+            auto node = nodes_[size_++] = tree_->create (slot_, like->key_, like->inf_, weight);
+
+            node->child_[dir].store (toward, std::memory_order_relaxed);
+            node->child_[1 - dir].store (away, std::memory_order_relaxed);
+
+            return node;
+        }
+
+        node_ptr copy (const Snapshot &snap, std::uint32_t weight)
+        {
+            return copy (snap.node, weight, 0, snap.child[0], snap.child[1]);
+        }
+
+        void release () noexcept { size_ = 0; }
+    };
+
+    // Destroyed after epoch_, which reclaims the remaining retired nodes into them
+    std::unique_ptr<Slot_State[]> slots_ = std::make_unique<Slot_State[]>(Epoch_Domain::max_slots);
+    mutable Epoch_Domain epoch_;
+
+    // info_ of nodes that no SCX has frozen yet
+    record_type dummy_;
+
+    // Sentinel internal node with key inf 2. Its left child is the root of the chromatic tree,
+    // which always has weight 1 and holds a leaf with key inf 1 greater than every key
+    node_ptr root_;
+
+public:
+
+    Lock_Free_Tree ()
+    {
+        dummy_.state_.store (State::aborted, std::memory_order_relaxed);
+
+        auto &arena = slots_[0].arena;
+
+        root_ = arena.construct (key_type{}, 2, 0, 1, &dummy_);
+        root_->child_[0] = arena.construct (key_type{}, 1, 0, 1, &dummy_);
+        root_->child_[1] = arena.construct (key_type{}, 2, 0, 1, &dummy_);
+    }
+
+    Lock_Free_Tree (const self &rhs) = delete;
+    self &operator= (const self &rhs) = delete;
+
+    // No other thread may access the tree
+    ~Lock_Free_Tree ()
+    {
+        std::vector<node_ptr> stack{root_};
+        while (!stack.empty())
+        {
+            auto node = stack.back();
+            stack.pop_back();
+
+            auto info = node->info_.load (std::memory_order_relaxed);
+            if (info != &dummy_ && info->n_refs_.fetch_sub (1, std::memory_order_relaxed) == 1)
+                delete info;
+
+            if (!is_leaf (node))
+            {
+                stack.push_back (node->child_[0].load (std::memory_order_relaxed));
+                stack.push_back (node->child_[1].load (std::memory_order_relaxed));
+            }
+        }
+    }
+
+    // Capacity
+
+    // Exact if no modification is in progress
+    size_type size () const
+    {
+        std::ptrdiff_t size = 0;
+        for (std::size_t i = 0; i != Epoch_Domain::max_slots; ++i)
+            size += slots_[i].size_delta.load (std::memory_order_relaxed);
+
+        return (size > 0) ? static_cast<size_type>(size) : 0;
+    }
+
+    bool empty () const { return begin() == end(); }
+
+    // Number of internal nodes on the longest path from the root to a leaf. It is at most
+    // 2 * log2 (n + 1) if no modification is in progress
+    size_type height () const
+    {
+        auto guard = epoch_.pin();
+
+        size_type height = 0;
+        std::vector<std::pair<node_ptr, size_type>> stack{{root_->child_[0].load(), 0}};
+        while (!stack.empty())
+        {
+            auto [node, depth] = stack.back();
+            stack.pop_back();
+
+            if (is_leaf (node))
+                height = std::max (height, depth);
+            else
+            {
+                stack.emplace_back (node->child_[0].load(), depth + 1);
+                stack.emplace_back (node->child_[1].load(), depth + 1);
+            }
+        }
+
+        return height;
+    }
+
+    // Iterators
+
+    const_iterator begin () const { return const_iterator{this, first_leaf_key()}; }
+    const_iterator cbegin () const { return begin(); }
+
+    const_iterator end () const { return const_iterator{this, std::nullopt}; }
+    const_iterator cend () const { return end(); }
+
+    // Modifiers
+
+    std::pair<iterator, bool> insert (const key_type &key)
+    {
+        auto guard = epoch_.pin();
+        auto slot = guard.slot();
+
+        for (;;)
+        {
+            auto [grandparent, parent, leaf] = search (key);
+            if (equal (key, leaf))
+                return {iterator{this, key}, false};
+
+            auto dir = direction (key, parent);
+
+            Snapshot parent_snap, leaf_snap;
+            if (!llx (parent, parent_snap, guard) || parent_snap.child[dir] != leaf ||
+                !llx (leaf, leaf_snap, guard))
+                continue;
+
+            // The leaf is replaced with an internal node that routes the greater of the two keys
+            // to the right. The weight of the path to the leaf stays the same
+            New_Nodes nodes{this, slot};
+
+            auto new_leaf = nodes.leaf (key, 0);
+            auto old_leaf = nodes.leaf (leaf->key_, leaf->inf_);
+            auto weight = (parent == root_) ? 1 : leaf->weight_ - 1;
+
+            auto internal = less (key, leaf) ? nodes.copy (leaf, weight, 0, new_leaf, old_leaf)
+                                             : nodes.copy (new_leaf, weight, 1, new_leaf, old_leaf);
+
+            if (scx (guard, {&parent_snap, &leaf_snap}, {leaf}, dir, internal))
+            {
+                nodes.release();
+                slots_[slot].size_delta.fetch_add (1, std::memory_order_relaxed);
+
+                if (weight == 0 && parent->weight_ == 0)
+                    cleanup (key, guard);
+
+                return {iterator{this, key}, true};
+            }
+        }
+    }
+
+    template<std::input_iterator it>
+    void insert (it first, it last)
+    {
+        for (; first != last; ++first)
+            insert (*first);
+    }
+
+    size_type erase (const key_type &key)
+    {
+        auto guard = epoch_.pin();
+        auto slot = guard.slot();
+
+        for (;;)
+        {
+            auto [grandparent, parent, leaf] = search (key);
+            if (!equal (key, leaf))
+                return 0;
+
+            // The leaf with inf 1 is in the left subtree of root_, so a leaf with a key is never
+            // its child and the grandparent exists
+            auto parent_dir = direction (key, grandparent);
+            auto dir = direction (key, parent);
+
+            Snapshot grandparent_snap, parent_snap;
+            if (!llx (grandparent, grandparent_snap, guard) ||
+                grandparent_snap.child[parent_dir] != parent ||
+                !llx (parent, parent_snap, guard) || parent_snap.child[dir] != leaf)
+                continue;
+
+            auto sibling = parent_snap.child[1 - dir];
+
+            Snapshot leaf_snap, sibling_snap;
+            if (!llx (leaf, leaf_snap, guard) || !llx (sibling, sibling_snap, guard))
+                continue;
+
+            // The parent and the leaf are removed, the sibling takes the weight of the parent
+            New_Nodes nodes{this, slot};
+
+            auto weight = (grandparent == root_) ? 1 : parent->weight_ + sibling->weight_;
+            auto new_sibling = nodes.copy (sibling_snap, weight);
+
+            if (scx (guard, {&grandparent_snap, &parent_snap, dir ? &sibling_snap : &leaf_snap,
+                                                              dir ? &leaf_snap : &sibling_snap},
+                     {parent, leaf, sibling}, parent_dir, new_sibling))
+            {
+                nodes.release();
+                slots_[slot].size_delta.fetch_sub (1, std::memory_order_relaxed);
+
+                if (weight > 1 || (weight == 0 && grandparent->weight_ == 0))
+                    cleanup (key, guard);
+
+                return 1;
+            }
+        }
+    }
+
+    // Lookup
+
+    const_iterator find (const key_type &key) const
+    {
+        return contains (key) ? const_iterator{this, key} : end();
+    }
+
+    const_iterator lower_bound (const key_type &key) const
+    {
+        return const_iterator{this, bound (key, false)};
+    }
+
+    const_iterator upper_bound (const key_type &key) const
+    {
+        return const_iterator{this, bound (key, true)};
+    }
+
+    bool contains (const key_type &key) const
+    {
+        auto guard = epoch_.pin();
+
+        auto node = root_->child_[0].load();
+        while (!is_leaf (node))
+            node = node->child_[direction (key, node)].load();
+
+        return equal (key, node);
+    }
+
+private:
+
+    static bool is_leaf (const node_type *node) noexcept { return node->child_[0].load() == nullptr; }
+
+    // key < node->key_
+    static bool less (const key_type &key, const node_type *node)
+    {
+        return node->inf_ || key < node->key_;
+    }
+
+    static bool equal (const key_type &key, const node_type *node)
+    {
+        return !node->inf_ && !(key < node->key_) && !(node->key_ < key);
+    }
+
+    // Index of the child of node on the search path of key
+    static std::size_t direction (const key_type &key, const node_type *node)
+    {
+        return less (key, node) ? 0 : 1;
+    }
+
+    // Index of child among the children in snap, or 2 if it is not a child
+    static std::size_t index_of (const Snapshot &snap, const node_type *child) noexcept
+    {
+        return (snap.child[0] == child) ? 0 : (snap.child[1] == child) ? 1 : 2;
+    }
+
+    // Epoch_Domain::pin() has to be held by the caller
+    node_ptr create (std::size_t slot, const key_type &key, std::uint8_t inf, std::uint32_t weight)
+    {
+        auto &state = slots_[slot];
+
+        if (state.remote_free.load (std::memory_order_relaxed))
+        {
+            auto node = state.remote_free.exchange (nullptr, std::memory_order_acquire);
+            while (node)
+            {
+                auto next = node->child_[0].load (std::memory_order_relaxed);
+                state.arena.destroy (node);
+                node = next;
+            }
+        }
+
+        return state.arena.construct (key, inf, static_cast<std::uint16_t>(slot), weight, &dummy_);
+    }
+
+    // Gives the node back to the arena it has been created in
+    static void reclaim (void *context, void *object)
+    {
+        auto tree = static_cast<self *>(context);
+        auto node = static_cast<node_ptr>(object);
+        auto &home = tree->slots_[node->home_];
+
+        auto head = home.remote_free.load (std::memory_order_relaxed);
+        do
+            node->child_[0].store (head, std::memory_order_relaxed);
+        while (!home.remote_free.compare_exchange_weak (head, node, std::memory_order_release,
+                                                        std::memory_order_relaxed));
+    }
+
+    static void delete_record (void *, void *object) { delete static_cast<record_ptr>(object); }
+
+    // Drops n references to the record
+    void release (record_ptr record, std::ptrdiff_t n, const Guard &guard)
+    {
+        if (record != &dummy_ && record->n_refs_.fetch_sub (n) == n)
+            epoch_.retire (guard, record, &delete_record, nullptr);
+    }
+
+    // The leaf where the search for key ends, its parent and its grandparent, which is null if
+    // the parent is root_
+    std::tuple<node_ptr, node_ptr, node_ptr> search (const key_type &key) const
+    {
+        node_ptr grandparent = nullptr;
+        node_ptr parent = root_;
+        node_ptr leaf = root_->child_[0].load();
+
+        while (!is_leaf (leaf))
+        {
+            grandparent = parent;
+            parent = leaf;
+            leaf = leaf->child_[direction (key, leaf)].load();
+        }
+
+        return {grandparent, parent, leaf};
+    }
+
+    // Load-link: reads the children of a node that is not frozen by an SCX in progress and has
+    // not been removed. Returns false otherwise, after helping the SCX that has frozen it
+    bool llx (node_ptr node, Snapshot &snap, const Guard &guard)
+    {
+        auto info = node->info_.load();
+        auto state = info->state_.load();
+
+        if (state == State::aborted || (state == State::committed && !node->marked_.load()))
+        {
+            snap.child[0] = node->child_[0].load();
+            snap.child[1] = node->child_[1].load();
+
+            if (node->info_.load() == info)
+            {
+                snap.node = node;
+                snap.info = info;
+
+                return true;
+            }
+        }
+
+        if (info->state_.load() == State::in_progress)
+            help (info, guard);
+
+        return false;
+    }
+
+    // Store-conditional: changes child dir of the first node of v to new_child if none of v has
+    // changed since its snapshot. The nodes of r are removed from the tree and retired
+    bool scx (const Guard &guard, std::initializer_list<const Snapshot *> v,
+              std::initializer_list<node_ptr> r, std::size_t dir, node_ptr new_child)
+    {
+        assert (v.size() <= record_type::max_nodes && r.size() <= v.size());
+
+        auto record = new record_type;
+        record->n_refs_.store (static_cast<std::ptrdiff_t>(v.size()) + 1, std::memory_order_relaxed);
+
+        for (auto snap : v)
+        {
+            record->v_[record->n_v_] = snap->node;
+            record->infos_[record->n_v_++] = snap->info;
+        }
+        for (auto node : r)
+            record->r_[record->n_r_++] = node;
+
+        auto top = *v.begin();
+        record->field_ = &top->node->child_[dir];
+        record->old_child_ = top->child[dir];
+        record->new_child_ = new_child;
+
+        auto committed = help (record, guard);
+        if (committed)
+        {
+            // Nodes of r stay frozen by the record until they are reclaimed
+            for (auto node : r)
+                epoch_.retire (guard, node, &reclaim, this);
+        }
+
+        release (record, committed ? static_cast<std::ptrdiff_t>(r.size()) + 1 : 1, guard);
+        return committed;
+    }
+
+    // Freezes the nodes of the record one by one, then marks the removed ones and swings the
+    // child pointer. Returns whether the record has been committed
+    bool help (record_ptr record, const Guard &guard)
+    {
+        for (std::size_t i = 0; i != record->n_v_; ++i)
+        {
+            auto expected = record->infos_[i];
+            if (record->v_[i]->info_.compare_exchange_strong (expected, record))
+                release (expected, 1, guard);
+            else if (expected != record)
+            {
+                // The node has changed since LLX: either another helper has already committed
+                // the record, or it cannot be committed and never froze nodes [i, n_v_)
+                if (record->all_frozen_.load())
+                    return true;
+
+                auto state = State::in_progress;
+                if (record->state_.compare_exchange_strong (state, State::aborted))
+                    release (record, static_cast<std::ptrdiff_t>(record->n_v_ - i), guard);
+
+                return false;
+            }
+        }
+
+        record->all_frozen_.store (true);
+        for (std::size_t i = 0; i != record->n_r_; ++i)
+            record->r_[i]->marked_.store (true);
+
+        auto expected = record->old_child_;
+        record->field_->compare_exchange_strong (expected, record->new_child_);
+
+        record->state_.store (State::committed);
+        return true;
+    }
+
+    // Repairs violations on the search path of key until there are none
+    void cleanup (const key_type &key, const Guard &guard)
+    {
+        for (;;)
+        {
+            // path[0] is the current node, path[i] is its i-th ancestor. The root has weight 1,
+            // so the nodes with a violation are at least two levels below root_
+            std::array<node_ptr, 4> path{root_->child_[0].load(), root_, nullptr, nullptr};
+
+            for (;;)
+            {
+                auto node = path[0];
+
+                if (node->weight_ > 1)
+                {
+                    fix_overweight (path[3], path[2], path[1], node, guard);
+                    break;
+                }
+
+                if (node->weight_ == 0 && path[1]->weight_ == 0)
+                {
+                    fix_red_red (path[3], path[2], path[1], node, guard);
+                    break;
+                }
+
+                if (is_leaf (node))
+                    return;
+
+                path = {node->child_[direction (key, node)].load(), path[0], path[1], path[2]};
+            }
+        }
+    }
+
+    // Red node x has red parent p. Does nothing if the nodes have changed
+    void fix_red_red (node_ptr gg, node_ptr g, node_ptr p, node_ptr x, const Guard &guard)
+    {
+        Snapshot gg_snap, g_snap, p_snap;
+        if (!llx (gg, gg_snap, guard) || !llx (g, g_snap, guard) || !llx (p, p_snap, guard))
+            return;
+
+        auto g_dir = index_of (gg_snap, g), p_dir = index_of (g_snap, p), x_dir = index_of (p_snap, x);
+
+        // A red grandparent is a violation of its own, which is repaired first
+        if (g_dir == 2 || p_dir == 2 || x_dir == 2 || g->weight_ == 0)
+            return;
+
+        New_Nodes nodes{this, guard.slot()};
+        auto u = g_snap.child[1 - p_dir];
+
+        if (u->weight_ == 0)
+        {
+            // Both children of g are red: they become black and g gives them one unit of weight
+            Snapshot u_snap;
+            if (!llx (u, u_snap, guard))
+                return;
+
+            auto new_p = nodes.copy (p_snap, 1);
+            auto new_u = nodes.copy (u_snap, 1);
+            auto new_g = nodes.copy (g, (gg == root_) ? 1 : g->weight_ - 1, p_dir, new_p, new_u);
+
+            if (scx (guard, {&gg_snap, &g_snap, p_dir ? &u_snap : &p_snap, p_dir ? &p_snap : &u_snap},
+                     {g, p, u}, g_dir, new_g))
+                nodes.release();
+        }
+        else if (x_dir == p_dir)
+        {
+            // x is an outer grandchild: single rotation at g
+            auto new_g = nodes.copy (g, 0, p_dir, p_snap.child[1 - x_dir], u);
+            auto new_p = nodes.copy (p, g->weight_, x_dir, x, new_g);
+
+            if (scx (guard, {&gg_snap, &g_snap, &p_snap}, {g, p}, g_dir, new_p))
+                nodes.release();
+        }
+        else
+        {
+            // x is an inner grandchild: double rotation at g
+            Snapshot x_snap;
+            if (!llx (x, x_snap, guard))
+                return;
+
+            auto new_p = nodes.copy (p, 0, p_dir, p_snap.child[p_dir], x_snap.child[p_dir]);
+            auto new_g = nodes.copy (g, 0, p_dir, x_snap.child[x_dir], u);
+            auto new_x = nodes.copy (x, g->weight_, p_dir, new_p, new_g);
+
+            if (scx (guard, {&gg_snap, &g_snap, &p_snap, &x_snap}, {g, p, x}, g_dir, new_x))
+                nodes.release();
+        }
+    }
+
+    // Node x has weight greater than 1. Does nothing if the nodes have changed
+    void fix_overweight (node_ptr ppp, node_ptr pp, node_ptr p, node_ptr x, const Guard &guard)
+    {
+        Snapshot pp_snap, p_snap;
+        if (!llx (pp, pp_snap, guard) || !llx (p, p_snap, guard))
+            return;
+
+        auto p_dir = index_of (pp_snap, p), x_dir = index_of (p_snap, x);
+        if (p_dir == 2 || x_dir == 2)
+            return;
+
+        auto s = p_snap.child[1 - x_dir];
+
+        // The sibling carries as much weight as x, so it is an internal node unless its own
+        // weight is greater than 1
+        assert (s->weight_ > 1 || !is_leaf (s));
+
+        Snapshot s_snap;
+        if (!llx (s, s_snap, guard))
+            return;
+
+        auto near = s_snap.child[x_dir];
+        auto far = s_snap.child[1 - x_dir];
+
+        New_Nodes nodes{this, guard.slot()};
+
+        if (s->weight_ == 0)
+        {
+            // A red sibling with a red parent or a red child is a red-red violation, which is
+            // repaired first. The root is black, so a red p has a parent below root_
+            if (p->weight_ == 0)
+            {
+                if (ppp)
+                    fix_red_red (ppp, pp, p, s, guard);
+                return;
+            }
+            if (near->weight_ == 0)
+            {
+                fix_red_red (pp, p, s, near, guard);
+                return;
+            }
+
+            // Rotation at p, after which x has a red parent and a sibling that is not red
+            auto new_p = nodes.copy (p, 0, x_dir, x, near);
+            auto new_s = nodes.copy (s, p->weight_, x_dir, new_p, far);
+
+            if (scx (guard, {&pp_snap, &p_snap, &s_snap}, {p, s}, p_dir, new_s))
+                nodes.release();
+
+            return;
+        }
+
+        Snapshot x_snap;
+        if (!llx (x, x_snap, guard))
+            return;
+
+        std::initializer_list<const Snapshot *> children{&pp_snap, &p_snap, x_dir ? &s_snap : &x_snap,
+                                                         x_dir ? &x_snap : &s_snap};
+        auto new_x = nodes.copy (x_snap, x->weight_ - 1);
+
+        if (s->weight_ > 1 || (!is_leaf (s) && near->weight_ && far->weight_))
+        {
+            // x and s push one unit of weight up to p
+            auto new_s = nodes.copy (s_snap, s->weight_ - 1);
+            auto new_p = nodes.copy (p, (pp == root_) ? 1 : p->weight_ + 1, x_dir, new_x, new_s);
+
+            if (scx (guard, children, {p, x, s}, p_dir, new_p))
+                nodes.release();
+        }
+        else if (far->weight_ == 0)
+        {
+            // Single rotation at p: the red far child of s becomes black
+            Snapshot far_snap;
+            if (!llx (far, far_snap, guard))
+                return;
+
+            auto new_p = nodes.copy (p, 1, x_dir, new_x, near);
+            auto new_far = nodes.copy (far_snap, 1);
+            auto new_s = nodes.copy (s, p->weight_, x_dir, new_p, new_far);
+
+            if (scx (guard, {&pp_snap, &p_snap, x_dir ? &s_snap : &x_snap,
+                             x_dir ? &x_snap : &s_snap, &far_snap},
+                     {p, x, s, far}, p_dir, new_s))
+                nodes.release();
+        }
+        else
+        {
+            // Double rotation at p: the red near child of s takes the place of p
+            Snapshot near_snap;
+            if (!llx (near, near_snap, guard))
+                return;
+
+            auto new_p = nodes.copy (p, 1, x_dir, new_x, near_snap.child[x_dir]);
+            auto new_s = nodes.copy (s, 1, x_dir, near_snap.child[1 - x_dir], far);
+            auto new_near = nodes.copy (near, p->weight_, x_dir, new_p, new_s);
+
+            if (scx (guard, {&pp_snap, &p_snap, x_dir ? &s_snap : &x_snap,
+                             x_dir ? &x_snap : &s_snap, &near_snap},
+                     {p, x, s, near}, p_dir, new_near))
+                nodes.release();
+        }
+    }
+
+    std::optional<key_type> next_key (const key_type &key) const { return bound (key, true); }
+
+    std::optional<key_type> first_leaf_key () const
+    {
+        auto guard = epoch_.pin();
+
+        auto node = root_->child_[0].load();
+        while (!is_leaf (node))
+            node = node->child_[0].load();
+
+        return node->inf_ ? std::nullopt : std::optional<key_type>{node->key_};
+    }
+
+    // The least key that is greater than (strict) or not less than key
+    std::optional<key_type> bound (const key_type &key, bool strict) const
+    {
+        auto guard = epoch_.pin();
+
+        // The right subtree of the last node where the search turned left
+        node_ptr greater = nullptr;
+
+        auto node = root_->child_[0].load();
+        while (!is_leaf (node))
+        {
+            if (less (key, node))
+            {
+                greater = node->child_[1].load();
+                node = node->child_[0].load();
+            }
+            else
+                node = node->child_[1].load();
+        }
+
+        if (!node->inf_ && (strict ? key < node->key_ : !(node->key_ < key)))
+            return node->key_;
+
+        if (!greater)
+            return std::nullopt;
+
+        while (!is_leaf (greater))
+            greater = greater->child_[0].load();
+
+        return greater->inf_ ? std::nullopt : std::optional<key_type>{greater->key_};
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_LOCK_FREE_TREE_HPP
@@ -0,0 +1,196 @@
+#ifndef INCLUDE_NODE_ARENA_HPP
+#define INCLUDE_NODE_ARENA_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "probes.hpp"
+
+namespace yLab
+{
+
+/*
+ * Allocates nodes one after another in page-aligned blocks. Nodes created together share pages,
+ * and no node crosses a page boundary, so modifying a node dirties exactly one page. This keeps
+ * the number of pages copied on write after fork() small (see checkpoint.hpp).
+ *
+ * Nodes are destroyed together with the arena or earlier by destroy(), which keeps the slot of
+ * the node for the next construct(). The most recently created nodes may also be destroyed in
+ * reverse order of creation by destroy_last(), which gives their memory back.
+ */
+template <typename Node_T>
+class Node_Arena final
+{
+public:
+
+    static constexpr std::size_t page_size = 4096;
+    static constexpr std::size_t pages_per_block = 16;
+    static constexpr std::size_t block_size = page_size * pages_per_block;
+
+    static constexpr std::size_t nodes_per_page = (sizeof (Node_T) <= page_size)
+                                                ? page_size / sizeof (Node_T) : 0;
+    static constexpr std::size_t nodes_per_block = (nodes_per_page)
+                                                 ? nodes_per_page * pages_per_block
+                                                 : block_size / sizeof (Node_T);
+
+    static_assert (nodes_per_block > 0, "Node is too big for an arena block");
+    static_assert (alignof (Node_T) <= page_size);
+
+private:
+
+    using self = Node_Arena<Node_T>;
+
+    // A slot freed by destroy() holds a link to the next free one
+    struct Free_Slot final
+    {
+        Free_Slot *next;
+    };
+
+    static_assert (sizeof (Node_T) >= sizeof (Free_Slot) && alignof (Node_T) >= alignof (Free_Slot));
+
+    struct Block_Deleter final
+    {
+        void operator() (std::byte *block) const
+        {
+            ::operator delete (block, std::align_val_t{page_size});
+        }
+    };
+
+    using u_block_ptr = std::unique_ptr<std::byte, Block_Deleter>;
+
+    std::vector<u_block_ptr> blocks_;
+    std::size_t size_ = 0; // Number of slots in use, including free ones
+
+    Free_Slot *free_ = nullptr;
+    std::size_t n_free_ = 0;
+
+public:
+
+    Node_Arena () = default;
+
+    Node_Arena (const self &rhs) = delete;
+    self &operator= (const self &rhs) = delete;
+
+    Node_Arena (self &&rhs) noexcept
+        : blocks_{std::move (rhs.blocks_)}, size_{std::exchange (rhs.size_, 0)},
+          free_{std::exchange (rhs.free_, nullptr)}, n_free_{std::exchange (rhs.n_free_, 0)} {}
+
+    self &operator= (self &&rhs) noexcept
+    {
+        std::swap (blocks_, rhs.blocks_);
+        std::swap (size_, rhs.size_);
+        std::swap (free_, rhs.free_);
+        std::swap (n_free_, rhs.n_free_);
+
+        return *this;
+    }
+
+    ~Node_Arena ()
+    {
+        if (n_free_ == 0)
+        {
+            while (size_)
+                destroy_last (slot (size_ - 1));
+            return;
+        }
+
+        std::vector<const void *> free_slots;
+        free_slots.reserve (n_free_);
+        for (auto free_slot = free_; free_slot; free_slot = free_slot->next)
+            free_slots.push_back (free_slot);
+        std::sort (free_slots.begin(), free_slots.end(), std::less<>{});
+
+        for (std::size_t i = 0; i != size_; ++i)
+        {
+            auto node = slot (i);
+            if (!std::binary_search (free_slots.begin(), free_slots.end(),
+                                     static_cast<const void *>(node), std::less<>{}))
+                node->~Node_T();
+        }
+    }
+
+    // Number of nodes that have not been destroyed
+    std::size_t size () const noexcept { return size_ - n_free_; }
+    std::size_t n_blocks () const noexcept { return blocks_.size(); }
+
+    template <typename... Args>
+    Node_T *construct (Args&&... args)
+    {
+        if (free_)
+        {
+            auto free_slot = free_;
+            auto next = free_slot->next;
+
+            free_slot->~Free_Slot();
+            auto node = new (free_slot) Node_T (std::forward<Args>(args)...);
+
+            free_ = next;
+            n_free_--;
+
+            return node;
+        }
+
+        if (size_ == blocks_.size() * nodes_per_block)
+        {
+            blocks_.emplace_back (static_cast<std::byte *>(::operator new (block_size,
+                                                                           std::align_val_t{page_size})));
+            YLAB_PROBE (arena__block, this, blocks_.size());
+        }
+
+        auto node = new (slot (size_)) Node_T (std::forward<Args>(args)...);
+        size_++;
+
+        return node;
+    }
+
+    // The slot of the node is reused by the next construct()
+    void destroy (Node_T *node) noexcept
+    {
+        assert (node);
+
+        node->~Node_T();
+        free_ = new (node) Free_Slot{free_};
+        n_free_++;
+    }
+
+    // Whether node occupies the last slot, so that it may be destroyed by destroy_last()
+    bool is_last (const Node_T *node) const noexcept { return size_ && node == slot (size_ - 1); }
+
+    // The node has to be the most recently created one among nodes that have not been destroyed
+    void destroy_last (Node_T *node) noexcept
+    {
+        assert (size_ && node == slot (size_ - 1));
+
+        node->~Node_T();
+        size_--;
+
+        // One spare block is kept in case the next node is created right away
+        if (blocks_.size() > size_ / nodes_per_block + 2)
+            blocks_.pop_back();
+    }
+
+private:
+
+    Node_T *slot (std::size_t i) const noexcept
+    {
+        auto block = blocks_[i / nodes_per_block].get();
+        auto in_block = i % nodes_per_block;
+
+        if constexpr (nodes_per_page != 0)
+            block += in_block / nodes_per_page * page_size + in_block % nodes_per_page * sizeof (Node_T);
+        else
+            block += in_block * sizeof (Node_T);
+
+        return reinterpret_cast<Node_T *>(block);
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_NODE_ARENA_HPP
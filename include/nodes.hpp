@@ -1,6 +1,7 @@
 #ifndef INCLUDE_NODES_HPP
 #define INCLUDE_NODES_HPP
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -46,12 +47,20 @@ class RB_Node final : public End_Node<RB_Node<Key_T> *>
     using base_ = End_Node<self *>;
 
 public:
+
+    using key_type = Key_T;
     
     self *parent_ = nullptr;
     self *right_  = nullptr;
 
     RB_Color color_;
 
+    std::size_t size_ = 1; // Number of nodes in the subtree rooted at this node
+
+#ifdef YLAB_COUNT_ACCESSES
+    mutable std::size_t n_accesses_ = 0; // Number of descents that passed through this node
+#endif
+
 private:
 
     Key_T key_;
@@ -68,6 +77,10 @@ public:
                 parent_{std::exchange (rhs.parent_, nullptr)},
                 right_ {std::exchange (rhs.right_,  nullptr)},
                 color_ {std::move (rhs.color_)},
+                size_  {std::exchange (rhs.size_, 1)},
+#ifdef YLAB_COUNT_ACCESSES
+                n_accesses_{std::exchange (rhs.n_accesses_, 0)},
+#endif
                 key_   {std::exchange (rhs.key_, Key_T{})} {}
             
     RB_Node &operator= (self &&rhs) noexcept
@@ -77,6 +90,10 @@ public:
         std::swap (right_,  rhs.right_);
         std::swap (key_,    rhs.key_);
         std::swap (color_,  rhs.color_);
+        std::swap (size_,   rhs.size_);
+#ifdef YLAB_COUNT_ACCESSES
+        std::swap (n_accesses_, rhs.n_accesses_);
+#endif
 
         return *this;
     }
@@ -84,6 +101,40 @@ public:
     const Key_T &key () const { return key_; }
 };
 
+// Node of SG_Tree: the same as RB_Node, but without a color
+template <typename Key_T>
+class SG_Node final : public End_Node<SG_Node<Key_T> *>
+{
+    using self  = SG_Node<Key_T>;
+    using base_ = End_Node<self *>;
+
+public:
+
+    using key_type = Key_T;
+
+    self *parent_ = nullptr;
+    self *right_  = nullptr;
+
+    std::size_t size_ = 1; // Number of nodes in the subtree rooted at this node
+
+#ifdef YLAB_COUNT_ACCESSES
+    mutable std::size_t n_accesses_ = 0; // Number of descents that passed through this node
+#endif
+
+private:
+
+    Key_T key_;
+
+public:
+
+    explicit SG_Node (Key_T key) : base_{}, key_{key} {}
+
+    SG_Node (const self &rhs) = delete;
+    SG_Node &operator= (const self &rhs) = delete;
+
+    const Key_T &key () const { return key_; }
+};
+
 } // namespace yLab
 
 #endif // INCLUDE_NODES_HPP
@@ -0,0 +1,650 @@
+#ifndef INCLUDE_PACKED_SET_HPP
+#define INCLUDE_PACKED_SET_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace yLab
+{
+
+/*
+ * Set of unsigned integers compressed with frame of reference. Keys are kept sorted in blocks of
+ * at most block_capacity keys. A block stores its keys as offsets from its minimum, bit-packed
+ * with the width of the largest offset, so dense ids take a few bits each instead of a node.
+ *
+ * Offsets are interleaved over n_lanes lanes: key i goes to lane i % n_lanes, and every lane is
+ * a bit stream of its own whose words alternate with the words of the other lanes. Keys of one
+ * group (n_lanes consecutive keys) sit at the same bit of adjacent words, so unpacking a group
+ * is the same shift and mask applied to n_lanes words, which the compiler turns into vector
+ * instructions. Unpacking is specialized for every width, so the mask is a constant.
+ *
+ * Blocks are routed by a B+-tree over their minima. Every entry of an index node also holds
+ * the number of keys under it, so count_less() and kth_smallest() descend the same tree. A full
+ * block is split in halves; the split updates the counts on the path and adds an entry to the
+ * parent, so it costs O(log n_blocks) and never moves other blocks. Inside a block the packed
+ * offsets are searched in place without decompressing the block.
+ */
+template <std::unsigned_integral Key_T = std::uint64_t>
+class Packed_Set final
+{
+public:
+
+    using key_type = Key_T;
+    using value_type = key_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+    static constexpr size_type block_capacity = 128;
+    static constexpr size_type fanout = 32;
+
+private:
+
+    using word_type = std::uint64_t;
+    static constexpr unsigned word_size = 64;
+    static constexpr unsigned n_lanes = 4;
+
+    static_assert (block_capacity % n_lanes == 0);
+
+    static constexpr auto no_block = static_cast<size_type>(-1);
+
+    struct Block final
+    {
+        std::vector<word_type> words; // has one extra row, so a key never ends in the last one
+        key_type min = 0;
+        size_type next = no_block;
+        std::uint16_t n = 0;
+        std::uint8_t width = 0;
+    };
+
+    // Child of an index node: a block on level 0 and an index node above
+    struct Entry final
+    {
+        key_type min;
+        size_type count;
+        size_type index;
+    };
+
+    struct Index_Node final
+    {
+        // The extra entry lets a node overflow before it is split
+        std::array<key_type, fanout + 1> minima{};
+        std::array<size_type, fanout + 1> counts{};
+        std::array<size_type, fanout + 1> children{};
+        size_type n = 0;
+    };
+
+    std::deque<Block> blocks_; // blocks never move, and the first block is always blocks_[0]
+    std::vector<Index_Node> nodes_;
+    size_type root_ = 0;
+    size_type height_ = 0; // number of index levels
+    size_type size_ = 0;
+
+public:
+
+    Packed_Set () = default;
+
+    // Keys in [first, last) have to be sorted and unique
+    template<std::input_iterator it>
+    Packed_Set (it first, it last)
+    {
+        std::array<key_type, block_capacity> buffer;
+        size_type n = 0;
+
+        for (; first != last; ++first)
+        {
+            assert ((size_ == 0 && n == 0) || (n ? buffer[n - 1] : last_key()) < *first);
+
+            buffer[n++] = *first;
+            if (n == block_capacity)
+            {
+                append_block (buffer.data(), n);
+                n = 0;
+            }
+        }
+
+        if (n)
+            append_block (buffer.data(), n);
+
+        build_index();
+    }
+
+    // Capacity
+
+    size_type size () const noexcept { return size_; }
+    bool empty () const noexcept { return size_ == 0; }
+    size_type n_blocks () const noexcept { return blocks_.size(); }
+
+    // Bytes taken by blocks and the index
+    size_type size_in_bytes () const noexcept
+    {
+        auto bytes = nodes_.capacity() * sizeof (Index_Node) + blocks_.size() * sizeof (Block);
+
+        for (auto &block : blocks_)
+            bytes += block.words.capacity() * sizeof (word_type);
+
+        return bytes;
+    }
+
+    // Iterators
+
+    const_iterator begin () const { return const_iterator{this, empty() ? no_block : 0, 0}; }
+    const_iterator end () const { return const_iterator{this, no_block, 0}; }
+
+    const_iterator cbegin () const { return begin(); }
+    const_iterator cend () const { return end(); }
+
+    // Calls func (key) for every key in ascending order decompressing a block at a time
+    template <typename F>
+    void for_each (F func) const
+    {
+        std::array<key_type, block_capacity> buffer;
+
+        for (auto b = empty() ? no_block : 0; b != no_block; b = blocks_[b].next)
+        {
+            auto &block = blocks_[b];
+
+            unpack (block, buffer.data());
+            for (size_type i = 0; i != block.n; ++i)
+                func (buffer[i]);
+        }
+    }
+
+    // Modifiers
+
+    std::pair<const_iterator, bool> insert (key_type key)
+    {
+        if (empty())
+        {
+            append_block (&key, 1);
+            build_index();
+            return {begin(), true};
+        }
+
+        auto b = route (key);
+        auto pos = lower_bound_in_block (b, key);
+
+        if (pos != blocks_[b].n && get (b, pos) == key)
+            return {const_iterator{this, b, pos}, false};
+
+        const_iterator result;
+        if (auto split = insert_into (root_, height_ - 1, key, result))
+        {
+            // The root has been split, so the tree grows a level
+            Index_Node root;
+            root.n = 2;
+            root.minima[0] = nodes_[root_].minima[0];
+            root.counts[0] = size_ - split->count;
+            root.children[0] = root_;
+            root.minima[1] = split->min;
+            root.counts[1] = split->count;
+            root.children[1] = split->index;
+
+            root_ = nodes_.size();
+            nodes_.push_back (root);
+            height_++;
+        }
+
+        return {result, true};
+    }
+
+    // Lookup
+
+    const_iterator find (key_type key) const
+    {
+        auto it = lower_bound (key);
+        return (it != end() && *it == key) ? it : end();
+    }
+
+    const_iterator lower_bound (key_type key) const
+    {
+        if (empty())
+            return end();
+
+        auto b = route (key);
+        return make_iterator (b, lower_bound_in_block (b, key));
+    }
+
+    const_iterator upper_bound (key_type key) const
+    {
+        if (empty())
+            return end();
+
+        auto b = route (key);
+        auto pos = lower_bound_in_block (b, key);
+
+        if (pos != blocks_[b].n && get (b, pos) == key)
+            pos++;
+
+        return make_iterator (b, pos);
+    }
+
+    bool contains (key_type key) const { return find (key) != end(); }
+
+    // Order statistics
+
+    // Number of keys that are less than key
+    size_type count_less (key_type key) const
+    {
+        if (empty())
+            return 0;
+
+        size_type before = 0;
+        auto b = route (key, &before);
+
+        return before + lower_bound_in_block (b, key);
+    }
+
+    // Iterator to the k-th smallest key (k starts from 0) or end() if k >= size()
+    const_iterator kth_smallest (size_type k) const
+    {
+        if (k >= size_)
+            return end();
+
+        auto child = root_;
+        for (auto level = height_; level--;)
+        {
+            auto &node = nodes_[child];
+
+            size_type slot = 0;
+            for (; node.counts[slot] <= k; ++slot)
+                k -= node.counts[slot];
+
+            child = node.children[slot];
+        }
+
+        return const_iterator{this, child, k};
+    }
+
+private:
+
+    key_type last_key () const { return get (blocks_.size() - 1, blocks_.back().n - 1); }
+
+    // Slot of the last child whose minimum is not greater than key or the first slot
+    static size_type slot_of (const Index_Node &node, key_type key)
+    {
+        auto it = std::upper_bound (node.minima.begin() + 1, node.minima.begin() + node.n, key);
+        return it - node.minima.begin() - 1;
+    }
+
+    // The last block whose minimum is not greater than key or the first block. Adds the number
+    // of keys in blocks before it to *before
+    size_type route (key_type key, size_type *before = nullptr) const
+    {
+        auto child = root_;
+        for (auto level = height_; level--;)
+        {
+            auto &node = nodes_[child];
+            auto slot = slot_of (node, key);
+
+            if (before)
+                *before += std::accumulate (node.counts.begin(), node.counts.begin() + slot,
+                                            size_type{0});
+
+            child = node.children[slot];
+        }
+
+        return child;
+    }
+
+    const_iterator make_iterator (size_type b, size_type pos) const
+    {
+        if (pos == blocks_[b].n)
+            return const_iterator{this, blocks_[b].next, 0};
+        else
+            return const_iterator{this, b, pos};
+    }
+
+    // Inserts a key that is not in the set under node index on the given level. Returns the
+    // entry of the new right sibling if the node has been split
+    std::optional<Entry> insert_into (size_type index, size_type level, key_type key,
+                                      const_iterator &result)
+    {
+        auto slot = slot_of (nodes_[index], key);
+        auto child = nodes_[index].children[slot];
+
+        auto split = level ? insert_into (child, level - 1, key, result)
+                           : insert_into_block (child, key, result);
+
+        // The recursion may have reallocated nodes_
+        auto &node = nodes_[index];
+        node.counts[slot]++;
+        node.minima[slot] = std::min (node.minima[slot], key);
+
+        if (!split)
+            return std::nullopt;
+
+        node.counts[slot] -= split->count;
+
+        for (auto i = node.n; i != slot + 1; --i)
+        {
+            node.minima[i] = node.minima[i - 1];
+            node.counts[i] = node.counts[i - 1];
+            node.children[i] = node.children[i - 1];
+        }
+
+        node.minima[slot + 1] = split->min;
+        node.counts[slot + 1] = split->count;
+        node.children[slot + 1] = split->index;
+        node.n++;
+
+        if (node.n <= fanout)
+            return std::nullopt;
+
+        return split_node (index);
+    }
+
+    // Moves the upper half of an overflown node to a new node
+    Entry split_node (size_type index)
+    {
+        Index_Node right;
+        auto &left = nodes_[index];
+        auto half = left.n / 2;
+
+        right.n = left.n - half;
+        std::copy_n (left.minima.begin() + half, right.n, right.minima.begin());
+        std::copy_n (left.counts.begin() + half, right.n, right.counts.begin());
+        std::copy_n (left.children.begin() + half, right.n, right.children.begin());
+        left.n = half;
+
+        Entry entry{right.minima[0],
+                    std::accumulate (right.counts.begin(), right.counts.begin() + right.n, size_type{0}),
+                    nodes_.size()};
+        nodes_.push_back (right);
+
+        return entry;
+    }
+
+    std::optional<Entry> insert_into_block (size_type b, key_type key, const_iterator &result)
+    {
+        std::array<key_type, block_capacity + 1> buffer;
+        unpack (blocks_[b], buffer.data());
+
+        auto n = size_type{blocks_[b].n};
+        auto pos = static_cast<size_type>(std::lower_bound (buffer.begin(), buffer.begin() + n, key)
+                                          - buffer.begin());
+
+        std::copy_backward (buffer.begin() + pos, buffer.begin() + n, buffer.begin() + n + 1);
+        buffer[pos] = key;
+        n++;
+        size_++;
+
+        if (n <= block_capacity)
+        {
+            pack (blocks_[b], buffer.data(), n);
+            result = const_iterator{this, b, pos};
+
+            return std::nullopt;
+        }
+
+        // Splits the block in halves. The new block goes to the end of blocks_ and is linked
+        // after block b
+        auto half = n / 2;
+        auto new_b = blocks_.size();
+
+        auto &right = blocks_.emplace_back();
+        auto &left = blocks_[b];
+
+        right.next = left.next;
+        left.next = new_b;
+
+        pack (left, buffer.data(), half);
+        pack (right, buffer.data() + half, n - half);
+
+        if (pos < half)
+            result = const_iterator{this, b, pos};
+        else
+            result = const_iterator{this, new_b, pos - half};
+
+        return Entry{right.min, n - half, new_b};
+    }
+
+    static size_type n_words (size_type n, unsigned width)
+    {
+        auto n_groups = (n + n_lanes - 1) / n_lanes;
+        return n_lanes * ((n_groups - 1) * width / word_size + 2);
+    }
+
+    static word_type extract (const word_type *words, unsigned width, size_type i)
+    {
+        auto bit = i / n_lanes * width;
+        auto row = words + bit / word_size * n_lanes + i % n_lanes;
+        auto shift = bit % word_size;
+
+        // The second shift is split in two, so that it is 0 rather than undefined if shift == 0
+        auto value = (row[0] >> shift) | ((row[n_lanes] << 1) << (word_size - 1 - shift));
+        auto mask = width ? ~word_type{0} >> (word_size - width) : word_type{0};
+
+        return value & mask;
+    }
+
+    key_type get (size_type b, size_type i) const
+    {
+        auto &block = blocks_[b];
+        assert (i < block.n);
+
+        return block.min + static_cast<key_type>(extract (block.words.data(), block.width, i));
+    }
+
+    // Binary search over packed offsets of block b without unpacking it
+    size_type lower_bound_in_block (size_type b, key_type key) const
+    {
+        auto &block = blocks_[b];
+        if (key < block.min)
+            return 0;
+
+        word_type offset = key - block.min;
+
+        size_type first = 0;
+        for (size_type count = block.n; count;)
+        {
+            auto step = count / 2;
+            if (extract (block.words.data(), block.width, first + step) < offset)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+                count = step;
+        }
+
+        return first;
+    }
+
+    // Writes group Group of a block with Width bits per offset. The shift is a constant and the
+    // same for all lanes, so the lane loops are compiled to vector shifts, masks and adds
+    template <unsigned Width, size_type Group>
+    static void unpack_group (const word_type *words, key_type base, key_type *keys)
+    {
+        constexpr auto bit = Group * Width;
+        constexpr auto shift = bit % word_size;
+        constexpr auto mask = Width ? ~word_type{0} >> (word_size - Width) : word_type{0};
+
+        auto row = words + bit / word_size * n_lanes;
+
+        // All words are read before any key is written, as keys may alias words
+        std::array<word_type, n_lanes> values;
+        for (unsigned lane = 0; lane != n_lanes; ++lane)
+        {
+            values[lane] = row[lane] >> shift;
+            if constexpr (shift + Width > word_size)
+                values[lane] |= row[lane + n_lanes] << (word_size - shift);
+        }
+
+        for (unsigned lane = 0; lane != n_lanes; ++lane)
+            keys[Group * n_lanes + lane] = base + static_cast<key_type>(values[lane] & mask);
+    }
+
+    // Unrolls the groups of a block, so that every group is unpacked with constant shifts
+    template <unsigned Width>
+    static void unpack_width (const word_type *words, key_type base, size_type n_groups,
+                              key_type *keys)
+    {
+        [&]<size_type... Groups>(std::index_sequence<Groups...>)
+        {
+            // Stops at the first group past the end of the block
+            (void)((Groups < n_groups
+                    && (unpack_group<Width, Groups> (words, base, keys), true)) && ...);
+        }(std::make_index_sequence<block_capacity / n_lanes>{});
+    }
+
+    // Writes the keys of a block to keys rounded up to a whole group, so keys has to have room
+    // for a multiple of n_lanes keys
+    static void unpack (const Block &block, key_type *keys)
+    {
+        using unpack_type = void (*)(const word_type *, key_type, size_type, key_type *);
+
+        static constexpr auto unpackers = []<std::size_t... Widths>(std::index_sequence<Widths...>)
+        {
+            return std::array<unpack_type, sizeof... (Widths)>{&unpack_width<Widths>...};
+        }(std::make_index_sequence<word_size + 1>{});
+
+        auto n_groups = (size_type{block.n} + n_lanes - 1) / n_lanes;
+        unpackers[block.width] (block.words.data(), block.min, n_groups, keys);
+    }
+
+    static void pack (Block &block, const key_type *keys, size_type n)
+    {
+        assert (0 < n && n <= block_capacity);
+
+        auto base = keys[0];
+
+        block.n = static_cast<std::uint16_t>(n);
+        block.width = static_cast<std::uint8_t>(std::bit_width (static_cast<word_type>(keys[n - 1] - base)));
+        block.words.assign (n_words (n, block.width), 0);
+        block.min = base;
+
+        for (size_type i = 0; i != n; ++i)
+        {
+            word_type offset = keys[i] - base;
+            auto bit = i / n_lanes * block.width;
+            auto word = bit / word_size * n_lanes + i % n_lanes;
+            auto shift = bit % word_size;
+
+            block.words[word] |= offset << shift;
+            if (shift + block.width > word_size)
+                block.words[word + n_lanes] |= offset >> (word_size - shift);
+        }
+    }
+
+    void append_block (const key_type *keys, size_type n)
+    {
+        if (!blocks_.empty())
+            blocks_.back().next = blocks_.size();
+
+        pack (blocks_.emplace_back(), keys, n);
+        size_ += n;
+    }
+
+    // Builds the index bottom-up over blocks that are linked in the order of blocks_.
+    // An empty set has no index
+    void build_index ()
+    {
+        if (blocks_.empty())
+            return;
+
+        std::vector<Entry> level;
+        for (size_type b = 0; b != blocks_.size(); ++b)
+            level.push_back (Entry{blocks_[b].min, blocks_[b].n, b});
+
+        nodes_.clear();
+        height_ = 0;
+
+        do
+        {
+            std::vector<Entry> parents;
+            for (size_type first = 0; first < level.size(); first += fanout)
+            {
+                Index_Node node;
+                node.n = std::min (fanout, level.size() - first);
+
+                for (size_type i = 0; i != node.n; ++i)
+                {
+                    node.minima[i] = level[first + i].min;
+                    node.counts[i] = level[first + i].count;
+                    node.children[i] = level[first + i].index;
+                }
+
+                parents.push_back (Entry{node.minima[0],
+                                         std::accumulate (node.counts.begin(),
+                                                          node.counts.begin() + node.n, size_type{0}),
+                                         nodes_.size()});
+                nodes_.push_back (node);
+            }
+
+            level = std::move (parents);
+            height_++;
+        } while (level.size() > 1);
+
+        root_ = level.front().index;
+    }
+
+public:
+
+    // Keys are decompressed on dereference, so the iterator yields them by value
+    class const_iterator final
+    {
+    public:
+
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = Key_T;
+        using reference = Key_T;
+
+    private:
+
+        const Packed_Set *set_ = nullptr;
+        size_type block_ = 0;
+        size_type pos_ = 0;
+
+    public:
+
+        const_iterator () = default;
+        const_iterator (const Packed_Set *set, size_type block, size_type pos)
+            : set_{set}, block_{block}, pos_{pos} {}
+
+        reference operator* () const { return set_->get (block_, pos_); }
+
+        const_iterator &operator++ ()
+        {
+            auto &block = set_->blocks_[block_];
+            if (++pos_ == block.n)
+            {
+                block_ = block.next;
+                pos_ = 0;
+            }
+
+            return *this;
+        }
+
+        const_iterator operator++ (int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator== (const const_iterator &rhs) const
+        {
+            return block_ == rhs.block_ && pos_ == rhs.pos_;
+        }
+    };
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_PACKED_SET_HPP
@@ -0,0 +1,38 @@
+#ifndef INCLUDE_PROBES_HPP
+#define INCLUDE_PROBES_HPP
+
+/*
+ * USDT (statically defined tracing) probes of provider "ylab", enabled by YLAB_USDT (the USDT
+ * option of CMake). An enabled probe is a single nop and a note in the .note.stapsdt section
+ * that tells a tracer where the nop is and where to find the arguments; it costs nothing until
+ * bpftrace, perf or SystemTap attaches to it, e.g.
+ *
+ *     bpftrace -e 'usdt:./bench_sequential:ylab:rotate__left { @[pid] = count(); }'
+ *
+ * The arguments are evaluated whether a tracer is attached or not, so probes only pass values
+ * that are already at hand: pointers and sizes. Without YLAB_USDT or <sys/sdt.h> probes expand
+ * to nothing. Every probe takes at least one argument.
+ *
+ *     insert__start (tree, size)               RB_Tree::insert() of any kind is entered
+ *     insert__done  (tree, size)               ... and returns; size grows if a key is inserted
+ *     fixup__step   (node)                     an iteration of rb_insert_fixup() starts at node
+ *     rotate__left  (node), rotate__right (node)
+ *     arena__block  (arena, n_blocks)          Node_Arena has allocated a block of nodes
+ *     batch__begin  (tree, size)
+ *     batch__commit (tree, n_undo_entries)
+ *     batch__rollback (tree, n_undo_entries)
+ */
+
+#if defined (YLAB_USDT) && __has_include (<sys/sdt.h>)
+
+#include <sys/sdt.h>
+
+#define YLAB_PROBE(name, ...) STAP_PROBEV (ylab, name, __VA_ARGS__)
+
+#else
+
+#define YLAB_PROBE(name, ...) ((void)0)
+
+#endif
+
+#endif // INCLUDE_PROBES_HPP
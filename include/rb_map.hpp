@@ -0,0 +1,283 @@
+#ifndef INCLUDE_RB_MAP_HPP
+#define INCLUDE_RB_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+namespace details
+{
+
+/*
+ * Key of RB_Map. Entries are ordered by key only. Besides the value, an entry keeps the number,
+ * the sum and the maximum of values in its subtree and an addition pending for its children:
+ * the value and the aggregates of the entry already include it.
+ */
+template <typename Key_T, typename Value_T>
+class Map_Entry final
+{
+public:
+
+    Key_T key{};
+
+    mutable Value_T value{};
+    mutable Value_T sum{};
+    mutable Value_T max{};
+    mutable Value_T pending{};
+    mutable std::size_t count = 1;
+
+    Map_Entry () = default;
+    Map_Entry (const Key_T &k, const Value_T &v = Value_T{}) : key{k}, value{v}, sum{v}, max{v} {}
+
+    bool operator< (const Map_Entry &rhs) const { return key < rhs.key; }
+    bool operator== (const Map_Entry &rhs) const { return key == rhs.key; }
+
+    // Adds delta to every value of the subtree
+    void apply (const Value_T &delta) const
+    {
+        value += delta;
+        sum += delta * static_cast<Value_T>(count);
+        max += delta;
+        pending += delta;
+    }
+
+    void push (const Map_Entry *left, const Map_Entry *right) const
+    {
+        if (pending == Value_T{})
+            return;
+
+        for (auto child : {left, right})
+            if (child)
+                child->apply (pending);
+
+        pending = Value_T{};
+    }
+
+    void pull (const Map_Entry *left, const Map_Entry *right) const
+    {
+        count = 1;
+        sum = max = value;
+
+        // Aggregates of the children do not include the addition pending for them
+        for (auto child : {left, right})
+            if (child)
+            {
+                count += child->count;
+                sum += child->sum + pending * static_cast<Value_T>(child->count);
+                max = std::max (max, child->max + pending);
+            }
+    }
+};
+
+} // namespace details
+
+/*
+ * Map from keys to arithmetic values on top of RB_Tree that adds a delta to all values in a
+ * range of keys and computes the sum and the maximum of values in a range of keys in O(log n).
+ *
+ * A range update stops at the roots of subtrees that lie in the range entirely and leaves the
+ * delta pending there (lazy propagation). Pending deltas are pushed down to the children before
+ * the tree changes them: on insertion along the path to the new node and on rotation, which
+ * also recomputes the aggregates of the rotated nodes. Queries do not modify the tree: they add
+ * up the deltas pending above the nodes they visit.
+ */
+template <typename Key_T, typename Value_T>
+class RB_Map final
+{
+public:
+
+    using key_type = Key_T;
+    using mapped_type = Value_T;
+    using size_type = std::size_t;
+    using entry_type = details::Map_Entry<key_type, mapped_type>;
+    using tree_type = RB_Tree<entry_type>;
+
+private:
+
+    using node_type = typename tree_type::node_type;
+    using node_ptr = const node_type *;
+
+    tree_type tree_;
+
+public:
+
+    // Capacity
+
+    size_type size () const { return tree_.size(); }
+    bool empty () const { return tree_.empty(); }
+
+    // Modifiers
+
+    // Returns false and leaves the map unchanged if the key is already there
+    bool insert (const key_type &key, const mapped_type &value)
+    {
+        return tree_.insert (entry_type{key, value}).second;
+    }
+
+    // Returns the number of erased keys: 0 or 1
+    size_type erase (const key_type &key) { return tree_.erase (entry_type{key}); }
+
+    // Adds delta to the values of all keys in [first, last]
+    void add (const key_type &first, const key_type &last, const mapped_type &delta)
+    {
+        if (last < first)
+            return;
+
+        add (root(), first, last, delta, false, false);
+    }
+
+    // Lookup
+
+    bool contains (const key_type &key) const { return tree_.contains (entry_type{key}); }
+
+    std::optional<mapped_type> value (const key_type &key) const
+    {
+        mapped_type pending{};
+        for (auto node = root(); node;)
+        {
+            auto &entry = node->key();
+
+            if (key < entry.key)
+                node = node->left_;
+            else if (entry.key < key)
+                node = node->right_;
+            else
+                return entry.value + pending;
+
+            pending += entry.pending;
+        }
+
+        return std::nullopt;
+    }
+
+    // Aggregates
+
+    // Sum of the values of all keys in [first, last]
+    mapped_type sum (const key_type &first, const key_type &last) const
+    {
+        mapped_type result{};
+        if (!(last < first))
+            aggregate (root(), first, last, mapped_type{}, false, false,
+                       [&result](const mapped_type &sum, const mapped_type &, const mapped_type &pending,
+                                 size_type count)
+                       {
+                           result += sum + pending * static_cast<mapped_type>(count);
+                       });
+
+        return result;
+    }
+
+    // Maximum of the values of all keys in [first, last] or nullopt if there are no such keys
+    std::optional<mapped_type> max (const key_type &first, const key_type &last) const
+    {
+        std::optional<mapped_type> result;
+        if (!(last < first))
+            aggregate (root(), first, last, mapped_type{}, false, false,
+                       [&result](const mapped_type &, const mapped_type &max, const mapped_type &pending,
+                                 size_type)
+                       {
+                           if (!result || *result < max + pending)
+                               result = max + pending;
+                       });
+
+        return result;
+    }
+
+    // Traversal
+
+    // Calls func (key, value) for every key in ascending order
+    template <typename F>
+    void for_each (F func) const { for_each (root(), mapped_type{}, func); }
+
+private:
+
+    node_ptr root () const { return tree_.end().base()->left_; }
+
+    /*
+     * first_ok and last_ok tell that all keys of the subtree are known to be not less than first
+     * and not greater than last. At most two paths are followed to the bottom: those of first and
+     * last. Every subtree that hangs off them into the range is handled at its root.
+     */
+    void add (node_ptr node, const key_type &first, const key_type &last, const mapped_type &delta,
+              bool first_ok, bool last_ok)
+    {
+        if (node == nullptr)
+            return;
+
+        if (first_ok && last_ok)
+        {
+            node->key().apply (delta);
+            return;
+        }
+
+        details::push (node);
+
+        auto &entry = node->key();
+        if (!first_ok && entry.key < first)
+            add (node->right_, first, last, delta, first_ok, last_ok);
+        else if (!last_ok && last < entry.key)
+            add (node->left_, first, last, delta, first_ok, last_ok);
+        else
+        {
+            entry.value += delta;
+            add (node->left_, first, last, delta, first_ok, true);
+            add (node->right_, first, last, delta, true, last_ok);
+        }
+
+        details::pull (node);
+    }
+
+    // Values of the entries do not include pending, which is the delta pending above node
+    template <typename F>
+    static void for_each (node_ptr node, const mapped_type &pending, F &func)
+    {
+        if (node == nullptr)
+            return;
+
+        auto &entry = node->key();
+        auto child_pending = pending + entry.pending;
+
+        for_each (node->left_, child_pending, func);
+        func (entry.key, entry.value + pending);
+        for_each (node->right_, child_pending, func);
+    }
+
+    // Calls visit (sum, max, pending, count) for every subtree and every single node that make
+    // up [first, last], where pending is the delta pending above it
+    template <typename F>
+    void aggregate (node_ptr node, const key_type &first, const key_type &last, mapped_type pending,
+                    bool first_ok, bool last_ok, F &&visit) const
+    {
+        if (node == nullptr)
+            return;
+
+        auto &entry = node->key();
+        if (first_ok && last_ok)
+        {
+            visit (entry.sum, entry.max, pending, entry.count);
+            return;
+        }
+
+        auto child_pending = pending + entry.pending;
+
+        if (!first_ok && entry.key < first)
+            aggregate (node->right_, first, last, child_pending, first_ok, last_ok, visit);
+        else if (!last_ok && last < entry.key)
+            aggregate (node->left_, first, last, child_pending, first_ok, last_ok, visit);
+        else
+        {
+            visit (entry.value, entry.value, pending, 1);
+            aggregate (node->left_, first, last, child_pending, first_ok, true, visit);
+            aggregate (node->right_, first, last, child_pending, true, last_ok, visit);
+        }
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_RB_MAP_HPP
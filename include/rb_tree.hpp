@@ -2,17 +2,46 @@
 #define INCLUDE_RB_TREE_HPP
 
 #include <utility>
+#include <algorithm>
+#include <cstdint>
 #include <initializer_list>
 #include <memory>
 #include <vector>
+#include <concepts>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <atomic>
+#include <thread>
+#include <tuple>
 
 #include "nodes.hpp"
+#include "node_arena.hpp"
 #include "tree_iterator.hpp"
 #include "details.hpp"
+#include "probes.hpp"
 
 namespace yLab
 {
 
+// How merge_from() inserts keys
+enum class Merge_Strategy
+{
+    automatic, // chosen by the cost model
+    insert,    // hinted insertion of each key
+    rebuild    // linear merge of sorted keys and rebuilding of the whole tree
+};
+
+// Expected number of nodes visited by a lookup of a key drawn according to the access weights
+struct Rebuild_Report final
+{
+    double expected_depth_before;
+    double expected_depth_after;
+};
+
 /*
  * Implementation details:
  * 1) root_->parent points to a non-null structure of type End_Node, which has a member
@@ -42,10 +71,9 @@ private:
     using const_node_ptr = const node_type *;
     using end_node_type = End_Node<node_ptr>;
     using end_node_ptr = end_node_type *;
-    using u_node_ptr = std::unique_ptr<node_type>;
     using u_end_node_ptr = std::unique_ptr<end_node_type>;
 
-    std::vector<u_node_ptr> nodes_;
+    Node_Arena<node_type> nodes_;
 
     u_end_node_ptr end_node_ = std::make_unique<end_node_type>();
 
@@ -54,11 +82,87 @@ private:
 
     std::size_t size_ = 0;
 
+    // Incremented whenever a key is added or removed
+    std::uint64_t version_ = 0;
+
+    // Unique among all trees ever constructed, so that a cursor is never taken for one of
+    // another tree, even if that tree lives at the same address and has the same version
+    std::uint64_t id_ = next_id();
+
+    static std::uint64_t next_id () noexcept
+    {
+        static std::atomic<std::uint64_t> counter{1};
+        return counter.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    // Sequential access detection: the last node reached by an insertion and the number of
+    // insertions in a row that have moved from the previous one in the same direction. Once the
+    // run is long enough, descents start from the finger instead of the root. Lookups never
+    // touch it; they take a Cursor instead
+    static constexpr unsigned sequential_run = 4;
+
+    node_ptr finger_ = nullptr;
+    unsigned run_ = 0;
+    bool ascending_ = true;
+
+    // False after rebuild_by_frequency(): the shape is not balanced and colors are meaningless.
+    // The tree is rebuilt into a red-black tree before the next insertion
+    bool balanced_ = true;
+
+    // Relaxed balancing: red nodes that may have a red parent. They are repaired by
+    // rebalance_step() instead of rb_insert_fixup() on insertion
+    bool relaxed_ = false;
+    std::size_t height_bound_ = 0;
+    std::vector<node_ptr> violations_;
+
+    // Transactional batches: every structural change made since begin_batch() is recorded,
+    // so that rollback() could undo them in reverse order
+    enum class Undo_Kind
+    {
+        link,
+        recolor,
+        left_rotate,
+        right_rotate
+    };
+
+    struct Undo_Entry final
+    {
+        Undo_Kind kind;
+        node_ptr node;
+        RB_Color color;
+    };
+
+    struct Undo_Journal final
+    {
+        std::vector<Undo_Entry> *log;
+
+        void on_recolor (node_ptr node) const { log->push_back ({Undo_Kind::recolor, node, node->color_}); }
+        void on_left_rotate (node_ptr node) const { log->push_back ({Undo_Kind::left_rotate, node, {}}); }
+        void on_right_rotate (node_ptr node) const { log->push_back ({Undo_Kind::right_rotate, node, {}}); }
+    };
+
+    bool in_batch_ = false;
+    std::vector<Undo_Entry> undo_log_;
+    node_ptr batch_leftmost_ = nullptr;
+    node_ptr batch_rightmost_ = nullptr;
+    std::size_t batch_size_ = 0;
+
+    // Fires the insert__start and insert__done probes around an insertion (see probes.hpp)
+    struct Insert_Probe final
+    {
+        const self *tree;
+
+        explicit Insert_Probe (const self *t) : tree{t} { YLAB_PROBE (insert__start, tree, tree->size_); }
+        ~Insert_Probe () { YLAB_PROBE (insert__done, tree, tree->size_); }
+    };
+
 public:
 
     RB_Tree () = default;
 
-    RB_Tree (const self &rhs) : size_{rhs.size_}
+    RB_Tree (const self &rhs)
+        : size_{rhs.size_}, balanced_{rhs.balanced_},
+          relaxed_{rhs.relaxed_}, height_bound_{rhs.height_bound_}
     {
         if (rhs.root())
         {
@@ -66,6 +170,7 @@ public:
 
             root() = insert_node (rhs_node->key(), rhs_node->color_);
             root()->parent_ = end_node();
+            root()->size_ = rhs_node->size_;
 
             node_ptr node = root();
             while (rhs_node != rhs.end_node())
@@ -76,6 +181,7 @@ public:
 
                     node->left_ = insert_node (rhs_node->key(), rhs_node->color_);
                     node->left_->parent_ = node;
+                    node->left_->size_ = rhs_node->size_;
                     node = node->left_;
 
                     if (rhs_node == rhs.leftmost_)
@@ -87,6 +193,7 @@ public:
 
                     node->right_ = insert_node (rhs_node->key(), rhs_node->color_);
                     node->right_->parent_ = node;
+                    node->right_->size_ = rhs_node->size_;
                     node = node->right_;
 
                     if (rhs_node == rhs.rightmost_)
@@ -98,6 +205,11 @@ public:
                     node = node->parent_;
                 }
             }
+
+            if (!rhs.violations_.empty())
+                for (auto it = begin(), ite = end(); it != ite; ++it)
+                    if (is_violation (it.base()))
+                        violations_.push_back (it.base());
         }
     }
 
@@ -110,11 +222,24 @@ public:
     }
 
     RB_Tree (self &&rhs) noexcept
-            : nodes_{std::move (rhs.node_)},
+            : nodes_{std::move (rhs.nodes_)},
               end_node_{std::move (rhs.end_node_)},
               leftmost_{std::exchange (rhs.leftmost_, rhs.end_node())},
               rightmost_{std::exchange (rhs.rightmost_, nullptr)},
-              size_{std::exchange (rhs.size_, 0)} {}
+              size_{std::exchange (rhs.size_, 0)},
+              version_{rhs.version_++},
+              finger_{std::exchange (rhs.finger_, nullptr)},
+              run_{std::exchange (rhs.run_, 0)},
+              ascending_{rhs.ascending_},
+              balanced_{std::exchange (rhs.balanced_, true)},
+              relaxed_{std::exchange (rhs.relaxed_, false)},
+              height_bound_{std::exchange (rhs.height_bound_, 0)},
+              violations_{std::move (rhs.violations_)},
+              in_batch_{std::exchange (rhs.in_batch_, false)},
+              undo_log_{std::move (rhs.undo_log_)},
+              batch_leftmost_{rhs.batch_leftmost_},
+              batch_rightmost_{rhs.batch_rightmost_},
+              batch_size_{rhs.batch_size_} {}
 
     self &operator= (self &&rhs) noexcept
     {
@@ -123,6 +248,21 @@ public:
         std::swap (leftmost_, rhs.leftmost_);
         std::swap (rightmost_, rhs.rightmost_);
         std::swap (size_, rhs.size_);
+        std::swap (finger_, rhs.finger_);
+        std::swap (run_, rhs.run_);
+        std::swap (ascending_, rhs.ascending_);
+        std::swap (balanced_, rhs.balanced_);
+        std::swap (relaxed_, rhs.relaxed_);
+        std::swap (height_bound_, rhs.height_bound_);
+        std::swap (violations_, rhs.violations_);
+        std::swap (in_batch_, rhs.in_batch_);
+        std::swap (undo_log_, rhs.undo_log_);
+        std::swap (batch_leftmost_, rhs.batch_leftmost_);
+        std::swap (batch_rightmost_, rhs.batch_rightmost_);
+        std::swap (batch_size_, rhs.batch_size_);
+
+        // Both trees have changed, so neither may return to a version it has already had
+        version_ = rhs.version_ = std::max (version_, rhs.version_) + 1;
 
         return *this;
     }
@@ -134,6 +274,9 @@ public:
     auto size () const { return size_; }
     bool empty () const { return size_ == 0; }
 
+    // Results of queries made at the same version are the same
+    std::uint64_t version () const noexcept { return version_; }
+
     // Iterators
 
     auto begin () { return iterator{leftmost_}; }
@@ -150,6 +293,11 @@ public:
 
     std::pair<iterator, bool> insert (const key_type &key)
     {
+        Insert_Probe probe{this};
+
+        if (!balanced_)
+            rebuild_balanced();
+
         if (empty())
         {
             auto new_node = insert_root (key);
@@ -157,8 +305,8 @@ public:
         }
         else
         {
-            auto [node, parent] = details::find_v2 (root(), key);
-        
+            auto [node, parent] = locate (key);
+
             if (node == nullptr) // No node with such key in the tree
             {
                 auto new_node = insert_hint_unique (parent, key);
@@ -169,6 +317,56 @@ public:
         }
     }
 
+    /*
+     * Inserts key and returns the number of keys less than it together with the result of
+     * insert (key), in one descent instead of insert (key) followed by count_less (key). The
+     * rank is counted on the way down from the root; fixup rotations after the insertion change
+     * the shape but not the number of smaller keys, and they keep the sizes of subtrees right.
+     */
+    std::tuple<iterator, size_type, bool> insert_with_rank (const key_type &key)
+    {
+        Insert_Probe probe{this};
+
+        if (!balanced_)
+            rebuild_balanced();
+
+        if (empty())
+            return {iterator{insert_root (key)}, 0, true};
+
+        size_type rank = 0;
+        auto [node, parent] = details::find_v2 (root(), key, &rank);
+
+        if (node)
+            return {iterator{node}, rank, false};
+        else
+            return {iterator{insert_hint_unique (parent, key)}, rank, true};
+    }
+
+    /*
+     * Starts the search from hint instead of the root and climbs up only as far as needed. If
+     * the hint is close to key (e.g. when keys are inserted in ascending order and the result
+     * of the previous insertion is passed as a hint), the descent is short and touches nodes
+     * that are likely to be in cache.
+     */
+    iterator insert (const_iterator hint, const key_type &key)
+    {
+        Insert_Probe probe{this};
+
+        if (!balanced_)
+            rebuild_balanced();
+
+        if (empty())
+            return iterator{insert_root (key)};
+
+        auto start = (hint == cend()) ? rightmost_ : const_cast<node_ptr>(hint.base());
+        auto [node, parent] = details::find_v2 (details::finger_climb (start, key, root()), key);
+
+        if (node)
+            return iterator{finger_ = node};
+        else
+            return iterator{insert_hint_unique (parent, key)};
+    }
+
     template<std::input_iterator it>
     void insert (it first, it last)
     {
@@ -182,6 +380,84 @@ public:
             insert_unique (*it);
     }
 
+    /*
+     * Inserts keys of a range sorted in ascending order (e.g. another tree). Inserting m keys one
+     * by one with hints takes O(m log(n / m + 1)) time, merging them with the nodes of the tree
+     * and rebuilding it takes O(n + m) time but has a greater constant factor. The cheaper
+     * strategy is chosen by the cost model unless it is given explicitly. Within a batch keys
+     * are always inserted one by one. The cost model measures the range first, so it has to be a
+     * forward range. Returns the number of inserted keys
+     */
+    template <std::ranges::forward_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, const key_type &>
+    size_type merge_from (const Range &keys, Merge_Strategy strategy = Merge_Strategy::automatic)
+    {
+        auto old_size = size_;
+
+        if (strategy == Merge_Strategy::automatic)
+            strategy = choose_merge_strategy (std::ranges::distance (keys));
+
+        if (strategy == Merge_Strategy::rebuild && !in_batch_)
+            merge_rebuild (keys);
+        else
+        {
+            auto first = std::ranges::begin (keys), last = std::ranges::end (keys);
+            if (first == last)
+                return 0;
+
+            auto hint = const_iterator{lower_bound (*first)};
+            for (; first != last; ++first)
+                hint = insert (hint, *first);
+        }
+
+        return size_ - old_size;
+    }
+
+    /*
+     * Unlinks the node in O(log n) time and keeps its memory for the next insertion, so erasing
+     * and inserting in turn does not allocate. In relaxed mode pending violations are repaired
+     * first. Erasure within a batch is not supported: rollback() only undoes insertions, so
+     * std::logic_error is thrown and the tree is left unchanged. Returns the iterator following pos
+     */
+    iterator erase (const_iterator pos)
+    {
+        if (in_batch_)
+            throw std::logic_error{"erase() within a batch"};
+        assert (pos != cend());
+
+        if (!balanced_)
+            rebuild_balanced();
+        rebalance();
+
+        auto node = const_cast<node_ptr>(pos.base());
+        auto next = details::successor (node);
+
+        if (node == leftmost_)
+            leftmost_ = next;
+        if (node == rightmost_)
+            rightmost_ = (size_ == 1) ? nullptr : details::predecessor (node);
+        if (node == finger_)
+            finger_ = nullptr;
+
+        unlink (node);
+        nodes_.destroy (node);
+
+        size_--;
+        version_++;
+
+        return iterator{next};
+    }
+
+    size_type erase (const key_type &key)
+    {
+        auto it = find (key);
+        if (it == end())
+            return 0;
+
+        erase (it);
+        return 1;
+    }
+
     // Lookup
 
     iterator find (const key_type &key)
@@ -222,6 +498,335 @@ public:
 
     bool contains (const key_type &key) const { return find (key) != end(); }
 
+    /*
+     * Position of a caller for lookups in sequential order. A lookup that takes a cursor
+     * remembers the node it reaches there. After a run of lookups that move in the same
+     * direction, the next descent starts from that node after an O(log d) climb, where d is the
+     * distance between the previous key and the current one. Such lookups write only to the
+     * cursor, so threads that share a tree should each have their own. A cursor starts over when
+     * it is used with another tree or after the tree has changed (see version()).
+     */
+    class Cursor final
+    {
+        friend class RB_Tree;
+
+        std::uint64_t tree_id_ = 0;
+        std::uint64_t version_ = 0;
+        node_ptr finger_ = nullptr;
+        unsigned run_ = 0;
+        bool ascending_ = true;
+    };
+
+    const_iterator find (Cursor &cursor, const key_type &key) const
+    {
+        if (empty())
+            return cend();
+
+        auto node = locate (cursor, key).first;
+        return (node) ? const_iterator{node} : cend();
+    }
+
+    const_iterator lower_bound (Cursor &cursor, const key_type &key) const
+    {
+        if (empty())
+            return cend();
+
+        auto [node, parent] = locate (cursor, key);
+        return const_iterator{(node) ? node : bound_of_place (parent, key)};
+    }
+
+    const_iterator upper_bound (Cursor &cursor, const key_type &key) const
+    {
+        if (empty())
+            return cend();
+
+        auto [node, parent] = locate (cursor, key);
+        return const_iterator{(node) ? details::successor (node) : bound_of_place (parent, key)};
+    }
+
+    // Order statistics
+
+    // k starts from 0; returns end() if k >= size()
+    iterator kth_smallest (size_type k)
+    {
+        auto node = details::kth_smallest (root(), k);
+        return (node) ? iterator{node} : end();
+    }
+
+    const_iterator kth_smallest (size_type k) const
+    {
+        auto node = details::kth_smallest (root(), k);
+        return (node) ? const_iterator{node} : cend();
+    }
+
+    size_type count_less (const key_type &key) const { return details::count_less (root(), key); }
+
+    // Export
+
+    /*
+     * Copies keys in ascending order to the first size() elements of out. The offset of a subtree
+     * in out is the number of keys before it, which is known from subtree sizes, so the top of the
+     * tree is split into subtrees that are copied by n_threads threads independently. Small trees
+     * are copied by the calling thread only.
+     */
+    void copy_to (std::span<key_type> out, size_type n_threads = std::thread::hardware_concurrency()) const
+    {
+        assert (out.size() >= size_);
+
+        n_threads = std::max<size_type>(n_threads, 1);
+        if (n_threads == 1 || size_ < parallel_export_threshold)
+        {
+            copy_subtree (root(), out.data());
+            return;
+        }
+
+        // Several subtrees per thread even out differences in their sizes
+        std::vector<Export_Task> tasks;
+        split_export (root(), 0, size_ / (n_threads * 8) + 1, out, tasks);
+
+        std::atomic<size_type> next_task{0};
+        auto work = [&]
+        {
+            for (auto i = next_task++; i < tasks.size(); i = next_task++)
+                copy_subtree (tasks[i].node, out.data() + tasks[i].offset);
+        };
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve (n_threads - 1);
+            for (size_type i = 1; i != n_threads; ++i)
+                threads.emplace_back (work);
+
+            work();
+        }
+    }
+
+    std::vector<key_type> to_vector (size_type n_threads = std::thread::hardware_concurrency()) const
+    {
+        std::vector<key_type> keys (size_);
+        copy_to (keys, n_threads);
+
+        return keys;
+    }
+
+    // Relaxed balancing
+
+    /*
+     * In relaxed mode insertions only link new nodes and remember the red-red violations they
+     * create, which takes the rebalancing work off the inserting thread. The violations are
+     * repaired by rebalance_step(). Lookups work as usual, but their cost depends on the height,
+     * so if a new node is deeper than height_bound levels, all violations are repaired at once.
+     * The bound should be greater than 2 * log2(n + 1), which is the height of a red-black tree.
+     */
+    void enable_relaxed_balance (size_type height_bound)
+    {
+        relaxed_ = true;
+        height_bound_ = height_bound;
+    }
+
+    // Repairs all pending violations
+    void disable_relaxed_balance ()
+    {
+        rebalance();
+        relaxed_ = false;
+    }
+
+    bool relaxed_balance () const noexcept { return relaxed_; }
+    size_type pending_violations () const noexcept { return violations_.size(); }
+
+    // Repairs at most budget violations, each in O(log n) time. Returns the number of
+    // violations left
+    size_type rebalance_step (size_type budget)
+    {
+        for (; budget && !violations_.empty(); --budget)
+        {
+            auto node = violations_.back();
+            violations_.pop_back();
+
+            if (repair (node))
+                violations_.push_back (node);
+        }
+
+        return violations_.size();
+    }
+
+    void rebalance ()
+    {
+        while (rebalance_step (violations_.size())) {}
+    }
+
+    // Transactional batches
+
+    /*
+     * Insertions made between begin_batch() and commit() are applied all together or, after
+     * rollback(), not at all. Within a batch new nodes are only linked, as in relaxed mode, and
+     * the red-red violations they create are repaired at once by commit(). Repairs that cannot
+     * wait because the tree would become too high are recorded, so rollback() takes time
+     * proportional to the size of the batch rather than to the size of the tree.
+     * Lookups within a batch see its insertions.
+     */
+    void begin_batch ()
+    {
+        assert (!in_batch_);
+
+        if (!balanced_)
+            rebuild_balanced();
+        rebalance();
+
+        YLAB_PROBE (batch__begin, this, size_);
+
+        in_batch_ = true;
+        batch_leftmost_ = leftmost_;
+        batch_rightmost_ = rightmost_;
+        batch_size_ = size_;
+    }
+
+    void commit ()
+    {
+        assert (in_batch_);
+        YLAB_PROBE (batch__commit, this, undo_log_.size());
+
+        if (!relaxed_)
+            rebalance();
+
+        in_batch_ = false;
+        undo_log_.clear();
+    }
+
+    void rollback ()
+    {
+        assert (in_batch_);
+        YLAB_PROBE (batch__rollback, this, undo_log_.size());
+
+        for (auto it = undo_log_.rbegin(), ite = undo_log_.rend(); it != ite; ++it)
+        {
+            auto node = it->node;
+
+            switch (it->kind)
+            {
+                case Undo_Kind::link:
+                    unlink_leaf (node);
+                    break;
+
+                case Undo_Kind::recolor:
+                    node->color_ = it->color;
+                    break;
+
+                // After a left rotation the node is the left child of the former right child
+                case Undo_Kind::left_rotate:
+                    details::right_rotate (node->parent_);
+                    break;
+
+                case Undo_Kind::right_rotate:
+                    details::left_rotate (node->parent_);
+                    break;
+            }
+        }
+
+        leftmost_ = batch_leftmost_;
+        rightmost_ = batch_rightmost_;
+        size_ = batch_size_;
+        violations_.clear();
+        finger_ = nullptr;
+
+        in_batch_ = false;
+        undo_log_.clear();
+    }
+
+    bool in_batch () const noexcept { return in_batch_; }
+
+    // Restructuring
+
+    /*
+     * Restructures the tree in place into a red-black tree of minimal height, e.g. before a long
+     * read-only phase (Day-Stout-Warren). Right rotations turn the tree into a vine of nodes
+     * linked by right_, and rounds of left rotations along the vine fold it into a complete tree.
+     * Nodes deeper than the full levels are colored red, the others black. Takes O(n) time
+     * and O(1) extra space; no node is created or moved in memory, so iterators stay valid.
+     * The rotations are not recorded for rollback(), so std::logic_error is thrown within a batch.
+     */
+    void rebalance_perfect ()
+    {
+        if (in_batch_)
+            throw std::logic_error{"rebalance_perfect() within a batch"};
+
+        tree_to_vine();
+
+        // Nodes of the last level, which is not full, go first
+        auto n = size_;
+        auto n_leaves = n + 1 - std::bit_floor (n + 1);
+        compress (n_leaves);
+
+        for (n -= n_leaves; n > 1; n /= 2)
+            compress (n / 2);
+
+        color_by_depth (n_full_levels (size_));
+
+        balanced_ = true;
+        violations_.clear();
+    }
+
+    /*
+     * Rebuilds the tree into a nearly optimal search tree for the access weights given by
+     * weight(key), so that frequently accessed keys are found after fewer comparisons.
+     * Takes O(n log n) time. The result is not a red-black tree: lookups keep working,
+     * but the next insertion rebuilds a balanced tree first in O(n) time. The new shape cannot
+     * be rolled back, so std::logic_error is thrown within a batch.
+     */
+    template <std::invocable<const key_type &> Weight_F>
+    Rebuild_Report rebuild_by_frequency (Weight_F weight)
+    {
+        if (in_batch_)
+            throw std::logic_error{"rebuild_by_frequency() within a batch"};
+
+        auto nodes = sorted_nodes();
+
+        std::vector<std::size_t> prefix (nodes.size() + 1);
+        for (std::size_t i = 0; i != nodes.size(); ++i)
+            // Keys which have never been accessed still need a place in the tree
+            prefix[i + 1] = prefix[i] + static_cast<std::size_t>(weight (nodes[i]->key())) + 1;
+
+        auto before = expected_depth (nodes, prefix);
+
+        if (!nodes.empty())
+        {
+            root() = details::build_weighted (nodes, prefix, 0, nodes.size());
+            root()->parent_ = end_node();
+        }
+        balanced_ = false;
+        violations_.clear();
+
+        return {before, expected_depth (nodes, prefix)};
+    }
+
+#ifdef YLAB_COUNT_ACCESSES
+    // Uses the number of descents that stopped at each node as its access weight.
+    // The counters are reset
+    Rebuild_Report rebuild_by_frequency ()
+    {
+        if (in_batch_)
+            throw std::logic_error{"rebuild_by_frequency() within a batch"};
+
+        auto n_accesses = [](node_ptr node) { return (node) ? node->n_accesses_ : 0; };
+
+        std::vector<std::pair<key_type, std::size_t>> weights;
+        weights.reserve (size_);
+        for (auto it = begin(), ite = end(); it != ite; ++it)
+        {
+            auto node = it.base();
+            auto passed = n_accesses (node->left_) + n_accesses (node->right_);
+            weights.emplace_back (node->key(), (node->n_accesses_ > passed) ? node->n_accesses_ - passed : 0);
+        }
+
+        for (auto it = begin(), ite = end(); it != ite; ++it)
+            it.base()->n_accesses_ = 0;
+
+        // Keys are visited in ascending order
+        std::size_t i = 0;
+        return rebuild_by_frequency ([&](const key_type &) { return weights[i++].second; });
+    }
+#endif
+
 private:
 
     node_ptr end_node () noexcept { return static_cast<node_ptr>(end_node_.get()); }
@@ -230,12 +835,383 @@ private:
     node_ptr &root () noexcept { return end_node()->left_; }
     const_node_ptr root () const noexcept { return end_node()->left_; }
 
-    node_ptr insert_node (const key_type &key, const RB_Color color)
+    bool is_violation (const_node_ptr node) const
+    {
+        return node->color_ == RB_Color::red && node->parent_ != end_node() &&
+               node->parent_->color_ == RB_Color::red;
+    }
+
+    // Nodes above the topmost red-red edge on the path from the node to the root satisfy
+    // red-black properties, so rb_insert_fixup() may be applied to that edge. Returns true if
+    // the node is still in violation after that
+    bool repair (node_ptr node)
+    {
+        if (!is_violation (node))
+            return false;
+
+        // The parent is red, so it is not the root and the grandparent exists
+        auto top = node;
+        while (top->parent_->parent_->color_ == RB_Color::red)
+            top = top->parent_;
+
+        fixup (top);
+
+        return is_violation (node);
+    }
+
+    void fixup (node_ptr node)
+    {
+        if (in_batch_)
+            details::rb_insert_fixup (root(), node, Undo_Journal{&undo_log_});
+        else
+            details::rb_insert_fixup (root(), node);
+    }
+
+    // Undoes linking of a node created within the current batch
+    void unlink_leaf (node_ptr node)
+    {
+        assert (node->left_ == nullptr && node->right_ == nullptr);
+
+        auto parent = node->parent_;
+        if (parent == end_node())
+            root() = nullptr;
+        else
+        {
+            if (details::is_left_child (node))
+                parent->left_ = nullptr;
+            else
+                parent->right_ = nullptr;
+
+            for (auto node = parent; node != end_node(); node = node->parent_)
+                node->size_--;
+
+            pull_path (parent);
+        }
+
+        // The slot of the node may have been freed by erase() before the batch
+        if (nodes_.is_last (node))
+            nodes_.destroy_last (node);
+        else
+            nodes_.destroy (node);
+        version_++;
+    }
+
+    struct Export_Task final
+    {
+        const_node_ptr node;
+        size_type offset;
+    };
+
+    static constexpr size_type parallel_export_threshold = 1 << 16;
+
+    // Copies keys of the subtrees of at most grain keys to tasks and the keys above them to out
+    void split_export (const_node_ptr node, size_type offset, size_type grain,
+                       std::span<key_type> out, std::vector<Export_Task> &tasks) const
+    {
+        if (details::size (node) <= grain)
+        {
+            if (node)
+                tasks.push_back ({node, offset});
+            return;
+        }
+
+        auto left_size = details::size (node->left_);
+        out[offset + left_size] = node->key();
+
+        split_export (node->left_, offset, grain, out, tasks);
+        split_export (node->right_, offset + left_size + 1, grain, out, tasks);
+    }
+
+    static void copy_subtree (const_node_ptr node, key_type *out)
+    {
+        auto n = details::size (node);
+        if (n == 0)
+            return;
+
+        for (node = details::minimum (node); n--; node = details::successor (node))
+            *out++ = node->key();
+    }
+
+    // Applies updates pending on the way from the root to node (augmented keys only)
+    void push_path (node_ptr node)
+    {
+        if constexpr (details::Augmented_Key<key_type>)
+        {
+            std::vector<node_ptr> path;
+            for (; node != end_node(); node = node->parent_)
+                path.push_back (node);
+
+            for (auto it = path.rbegin(), ite = path.rend(); it != ite; ++it)
+                details::push (*it);
+        }
+    }
+
+    // Recomputes aggregates on the way from node to the root (augmented keys only)
+    void pull_path (node_ptr node)
+    {
+        if constexpr (details::Augmented_Key<key_type>)
+            for (; node != end_node(); node = node->parent_)
+                details::pull (node);
+    }
+
+    // Applies all pending updates, e.g. before nodes are relinked (augmented keys only)
+    void push_all ()
+    {
+        if constexpr (details::Augmented_Key<key_type>)
+        {
+            std::vector<node_ptr> stack;
+            if (root())
+                stack.push_back (root());
+
+            while (!stack.empty())
+            {
+                auto node = stack.back();
+                stack.pop_back();
+
+                details::push (node);
+                for (auto child : {node->left_, node->right_})
+                    if (child)
+                        stack.push_back (child);
+            }
+        }
+    }
+
+    std::vector<node_ptr> sorted_nodes ()
+    {
+        push_all();
+
+        std::vector<node_ptr> nodes;
+        nodes.reserve (size_);
+
+        for (auto it = begin(), ite = end(); it != ite; ++it)
+            nodes.push_back (it.base());
+
+        return nodes;
+    }
+
+    void rebuild_balanced () { link_balanced (sorted_nodes()); }
+
+    // Number of full levels of a tree of minimal height with n nodes
+    static std::size_t n_full_levels (std::size_t n)
+    {
+        std::size_t n_levels = 0;
+        while ((std::size_t{2} << n_levels) - 1 <= n)
+            n_levels++;
+
+        return n_levels;
+    }
+
+    // Links nodes sorted by key into a red-black tree of minimal height
+    void link_balanced (const std::vector<node_ptr> &nodes)
+    {
+        if (!nodes.empty())
+        {
+            root() = details::build_balanced (nodes, 0, nodes.size(), 0, n_full_levels (nodes.size()));
+            root()->parent_ = end_node();
+
+            leftmost_ = nodes.front();
+            rightmost_ = nodes.back();
+        }
+        balanced_ = true;
+        violations_.clear();
+    }
+
+    // Rotates left children up until every node has only a right child
+    void tree_to_vine ()
     {
-        u_node_ptr new_node {new node_type{key, color}};
-        nodes_.push_back (std::move (new_node));
+        for (auto node = root(); node;)
+        {
+            if (node->left_)
+            {
+                details::right_rotate (node);
+                node = node->parent_;
+            }
+            else
+                node = node->right_;
+        }
+    }
 
-        return nodes_.back().get();
+    // Rotates left every second node of the first 2 * count nodes of the vine
+    void compress (std::size_t count)
+    {
+        for (auto node = root(); count; --count)
+        {
+            details::left_rotate (node);
+            node = node->parent_->right_;
+        }
+    }
+
+    // Colors nodes of the first n_black_levels levels black and the others red. The traversal
+    // follows parent links, so it needs no stack
+    void color_by_depth (std::size_t n_black_levels)
+    {
+        const_node_ptr prev = end_node();
+        std::size_t depth = 0;
+
+        for (auto node = root(); node && node != end_node();)
+        {
+            node_ptr next = nullptr;
+
+            if (prev == node->parent_)
+            {
+                node->color_ = (depth < n_black_levels) ? RB_Color::black : RB_Color::red;
+                next = (node->left_) ? node->left_ : node->right_;
+            }
+            else if (prev == node->left_)
+                next = node->right_;
+
+            prev = node;
+            if (next)
+            {
+                node = next;
+                depth++;
+            }
+            else
+            {
+                node = node->parent_;
+                depth--;
+            }
+        }
+    }
+
+    /*
+     * Costs in nanoseconds measured by bench_merge: hinted insertion of a key takes about
+     * insert_base_cost + insert_level_cost * log2(n / m + 1), rebuilding takes about
+     * rebuild_node_cost per node of the result. The insertion cost is fitted for n / m < 16,
+     * where the strategies break even; for larger ratios it grows faster because of cache
+     * misses, which only makes insertion more preferable there
+     */
+    static constexpr double insert_base_cost = 100.0;
+    static constexpr double insert_level_cost = 35.0;
+    static constexpr double rebuild_node_cost = 60.0;
+
+    Merge_Strategy choose_merge_strategy (std::ptrdiff_t n_keys) const
+    {
+        if (n_keys <= 0)
+            return Merge_Strategy::insert;
+
+        auto m = static_cast<double>(n_keys);
+        auto n = static_cast<double>(size_);
+
+        auto insert_cost = m * (insert_base_cost + insert_level_cost * std::log2 (n / m + 1.0));
+        auto rebuild_cost = (n + m) * rebuild_node_cost;
+
+        return (rebuild_cost < insert_cost) ? Merge_Strategy::rebuild : Merge_Strategy::insert;
+    }
+
+    template <std::ranges::forward_range Range>
+    void merge_rebuild (const Range &keys)
+    {
+        assert (std::ranges::is_sorted (keys, [](const key_type &lhs, const key_type &rhs)
+                                              { return lhs < rhs; }));
+
+        auto old_nodes = sorted_nodes();
+
+        std::vector<node_ptr> nodes;
+        nodes.reserve (old_nodes.size());
+
+        auto old_it = old_nodes.begin(), old_ite = old_nodes.end();
+        for (auto &&key_ref : keys)
+        {
+            const key_type &key = key_ref;
+
+            for (; old_it != old_ite && (*old_it)->key() < key; ++old_it)
+                nodes.push_back (*old_it);
+
+            // Keys already in the tree and repeated keys of the range are skipped
+            if (old_it != old_ite && !(key < (*old_it)->key()))
+                continue;
+            if (!nodes.empty() && !(nodes.back()->key() < key))
+                continue;
+
+            nodes.push_back (insert_node (key, RB_Color::red));
+        }
+        nodes.insert (nodes.end(), old_it, old_ite);
+
+        link_balanced (nodes);
+        size_ = nodes.size();
+    }
+
+    // Weighted average of depths of nodes counting from 1. nodes are sorted by key, prefix[i]
+    // is the total weight of nodes[0, i)
+    double expected_depth (const std::vector<node_ptr> &nodes,
+                           const std::vector<std::size_t> &prefix) const
+    {
+        if (nodes.empty())
+            return 0.0;
+
+        double path_length = 0.0;
+        for (std::size_t i = 0; i != nodes.size(); ++i)
+        {
+            std::size_t depth = 0;
+            for (const_node_ptr node = nodes[i]; node != end_node(); node = node->parent_)
+                depth++;
+
+            path_length += static_cast<double>(prefix[i + 1] - prefix[i]) * depth;
+        }
+
+        return path_length / prefix.back();
+    }
+
+    // The node to start the search for key from: finger in a run of sequential_run accesses
+    // that have moved from it in the same direction, the root otherwise. Extends the run
+    static node_ptr descent_start (node_ptr finger, unsigned &run, bool &ascending,
+                                   const key_type &key, node_ptr root)
+    {
+        if (finger == nullptr)
+            return root;
+
+        auto ascending_now = !(key < finger->key());
+        if (ascending_now != ascending)
+        {
+            ascending = ascending_now;
+            run = 0;
+        }
+        else if (run < sequential_run)
+            run++;
+
+        return (run == sequential_run) ? details::finger_climb (finger, key, root) : root;
+    }
+
+    // Same as details::find_v2 from the root, but starts closer to key in a sequential run of
+    // insertions. The tree must not be empty
+    std::pair<node_ptr, node_ptr> locate (const key_type &key)
+    {
+        auto result = details::find_v2 (descent_start (finger_, run_, ascending_, key, root()), key);
+        finger_ = (result.first) ? result.first : result.second;
+
+        return result;
+    }
+
+    // Same for a lookup with a cursor, which is the only thing written
+    std::pair<node_ptr, node_ptr> locate (Cursor &cursor, const key_type &key) const
+    {
+        if (cursor.tree_id_ != id_ || cursor.version_ != version_)
+        {
+            cursor = Cursor{};
+            cursor.tree_id_ = id_;
+            cursor.version_ = version_;
+        }
+
+        auto root = const_cast<node_ptr>(this->root());
+        auto start = descent_start (cursor.finger_, cursor.run_, cursor.ascending_, key, root);
+
+        auto result = details::find_v2 (start, key);
+        cursor.finger_ = (result.first) ? result.first : result.second;
+
+        return result;
+    }
+
+    // The first node greater than key, which is not in the tree and whose place is a child of parent
+    static node_ptr bound_of_place (node_ptr parent, const key_type &key)
+    {
+        return (key < parent->key()) ? parent : details::successor (parent);
+    }
+
+    node_ptr insert_node (const key_type &key, const RB_Color color)
+    {
+        version_++;
+        return nodes_.construct (key, color);
     }
 
     node_ptr insert_root (const key_type &key)
@@ -244,25 +1220,36 @@ private:
         
         root() = new_node;
         root()->parent_ = end_node();
+        finger_ = new_node;
 
         leftmost_ = rightmost_ = new_node;
         size_++;
 
+        if (in_batch_)
+            undo_log_.push_back ({Undo_Kind::link, new_node, {}});
+
         return new_node;
     }
 
     node_ptr insert_hint_unique (node_ptr parent, const key_type &key)
     {
+        // Updates pending above parent would apply to the new node too
+        push_path (parent);
+
         auto new_node = insert_node (key, RB_Color::red);
         new_node->parent_ = parent;
+        finger_ = new_node;
 
         if (key < parent->key())
             parent->left_ = new_node;
         else
             parent->right_ = new_node;
 
-        details::rb_insert_fixup (root(), new_node);
+        std::size_t depth = 1;
+        for (auto node = parent; node != end_node(); node = node->parent_, depth++)
+            node->size_++;
 
+        // Rotations may move new_node away from its parent, so it is checked before fixup
         if (new_node == leftmost_->left_)
             leftmost_ = new_node;
         else if (new_node == rightmost_->right_)
@@ -270,23 +1257,44 @@ private:
 
         size_++;
 
+        if (in_batch_)
+            undo_log_.push_back ({Undo_Kind::link, new_node, {}});
+
+        if (relaxed_ || in_batch_)
+        {
+            if (parent->color_ == RB_Color::red)
+                violations_.push_back (new_node);
+
+            // Without relaxed mode the bound is the greatest height of a red-black tree
+            auto height_bound = relaxed_ ? height_bound_ : 2 * std::bit_width (size_);
+            if (depth > height_bound)
+                rebalance();
+        }
+        else
+            fixup (new_node);
+
+        pull_path (new_node);
         return new_node;
     }
 
     void insert_unique (const key_type &key)
     {
+        Insert_Probe probe{this};
+
+        if (!balanced_)
+            rebuild_balanced();
+
         if (empty())
             insert_root (key);
         else
         {
-            auto [node, parent] = details::find_v2 (root(), key);
-        
+            auto [node, parent] = locate (key);
+
             if (node == nullptr)
                 insert_hint_unique (parent, key);
         }
     }
 
-#if 0
     // Replaces subtree rooted at node U with the subtree rooted at node V
     void transplant (node_ptr u, node_ptr v)
     {
@@ -297,9 +1305,59 @@ private:
         else
             u->parent_->right_ = v;
 
-        v->parent_ = u->parent_;
+        if (v)
+            v->parent_ = u->parent_;
+    }
+
+    // Unlinks node from a red-black tree and restores its properties
+    void unlink (node_ptr node)
+    {
+        auto color = node->color_;
+        node_ptr x, x_parent;
+
+        if (node->left_ == nullptr || node->right_ == nullptr)
+        {
+            push_path (node);
+
+            x = (node->left_) ? node->left_ : node->right_;
+            x_parent = node->parent_;
+            transplant (node, x);
+        }
+        else
+        {
+            // The successor takes the place of node
+            auto next = details::minimum (node->right_);
+            push_path (next);
+
+            color = next->color_;
+            x = next->right_;
+
+            if (next->parent_ == node)
+                x_parent = next;
+            else
+            {
+                x_parent = next->parent_;
+                transplant (next, next->right_);
+                next->right_ = node->right_;
+                next->right_->parent_ = next;
+            }
+
+            transplant (node, next);
+            next->left_ = node->left_;
+            next->left_->parent_ = next;
+            next->color_ = node->color_;
+        }
+
+        // Subtrees that have lost a node are on the way from the place of x to the root
+        for (auto parent = x_parent; parent != end_node(); parent = parent->parent_)
+        {
+            parent->size_ = details::size (parent->left_) + details::size (parent->right_) + 1;
+            details::pull (parent);
+        }
+
+        if (color == RB_Color::black)
+            details::rb_erase_fixup (x, x_parent, end_node());
     }
-#endif
 };
 
 } // namespace yLab
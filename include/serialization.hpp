@@ -0,0 +1,105 @@
+#ifndef INCLUDE_SERIALIZATION_HPP
+#define INCLUDE_SERIALIZATION_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+/*
+ * Binary format: a header followed by the keys in ascending order as they are laid out in memory.
+ * Keys have to be trivially copyable, and the data is only meant to be read on a machine of the
+ * same architecture.
+ */
+namespace serialization
+{
+
+struct Header final
+{
+    char magic[4];
+    std::uint32_t key_size;
+    std::uint64_t n_keys;
+};
+
+inline constexpr char magic[4] = {'y', 'L', 'R', 'B'};
+
+// Number of keys written or read by one stream operation
+inline constexpr std::size_t chunk_size = 4096;
+
+template <typename Key_T>
+requires std::is_trivially_copyable_v<Key_T>
+void serialize (std::ostream &os, const RB_Tree<Key_T> &tree)
+{
+    Header header{{}, sizeof (Key_T), tree.size()};
+    std::memcpy (header.magic, magic, sizeof (magic));
+    os.write (reinterpret_cast<const char *>(&header), sizeof (header));
+
+    std::vector<Key_T> chunk;
+    chunk.reserve (chunk_size);
+
+    for (auto it = tree.begin(), ite = tree.end(); it != ite; ++it)
+    {
+        chunk.push_back (*it);
+        if (chunk.size() == chunk_size)
+        {
+            os.write (reinterpret_cast<const char *>(chunk.data()), chunk.size() * sizeof (Key_T));
+            chunk.clear();
+        }
+    }
+
+    os.write (reinterpret_cast<const char *>(chunk.data()), chunk.size() * sizeof (Key_T));
+
+    if (!os)
+        throw std::runtime_error{"failed to write the tree"};
+}
+
+template <typename Key_T>
+requires std::is_trivially_copyable_v<Key_T> && std::is_default_constructible_v<Key_T>
+RB_Tree<Key_T> deserialize (std::istream &is)
+{
+    Header header;
+    if (!is.read (reinterpret_cast<char *>(&header), sizeof (header)))
+        throw std::runtime_error{"failed to read the header"};
+
+    if (std::memcmp (header.magic, magic, sizeof (magic)) != 0)
+        throw std::runtime_error{"the data is not a serialized tree"};
+    if (header.key_size != sizeof (Key_T))
+        throw std::runtime_error{"the size of keys does not match"};
+
+    RB_Tree<Key_T> tree;
+    auto hint = tree.cend();
+
+    std::vector<Key_T> chunk (chunk_size);
+    for (auto n_left = header.n_keys; n_left; )
+    {
+        auto n_keys = std::min<std::uint64_t>(n_left, chunk_size);
+        if (!is.read (reinterpret_cast<char *>(chunk.data()), n_keys * sizeof (Key_T)))
+            throw std::runtime_error{"unexpected end of data"};
+
+        // Keys are ascending, so each of them is inserted right after the previous one
+        for (std::size_t i = 0; i != n_keys; ++i)
+            hint = tree.insert (hint, chunk[i]);
+
+        n_left -= n_keys;
+    }
+
+    if (tree.size() != header.n_keys)
+        throw std::runtime_error{"keys are not unique"};
+
+    return tree;
+}
+
+} // namespace serialization
+
+} // namespace yLab
+
+#endif // INCLUDE_SERIALIZATION_HPP
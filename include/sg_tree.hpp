@@ -0,0 +1,449 @@
+#ifndef INCLUDE_SG_TREE_HPP
+#define INCLUDE_SG_TREE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "nodes.hpp"
+#include "node_arena.hpp"
+#include "tree_iterator.hpp"
+#include "details.hpp"
+
+namespace yLab
+{
+
+/*
+ * Scapegoat tree (Galperin and Rivest, 1993) with the interface of RB_Tree. Nodes keep no color
+ * or other balance information, only the sizes of subtrees that order statistics need anyway,
+ * and lookups never change the tree.
+ *
+ * The tree is kept alpha-height-balanced: no node is deeper than log (n) / log (1 / alpha).
+ * An insertion that puts a node deeper than that climbs to the nearest ancestor whose child is
+ * heavier than alpha times its size (the scapegoat) and rebuilds the subtree of the scapegoat
+ * into a perfectly balanced one in time linear in its size. When erasures shrink the tree below
+ * alpha times its size after the last full rebuild, the whole tree is rebuilt. Both take O(log n)
+ * amortized time. Smaller alpha gives lower trees at the cost of more frequent rebuilds.
+ */
+template <typename Key_T>
+class SG_Tree final
+{
+public:
+
+    using key_type = Key_T;
+    using value_type = key_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using node_type = SG_Node<key_type>;
+    using pointer = value_type *;
+    using const_pointer = const value_type *;
+    using iterator = tree_iterator<key_type, node_type>;
+    using const_iterator = tree_iterator<key_type, const node_type>;
+
+    static constexpr double default_alpha = 0.7;
+
+private:
+
+    using self = SG_Tree<key_type>;
+    using node_ptr = node_type *;
+    using const_node_ptr = const node_type *;
+    using end_node_type = End_Node<node_ptr>;
+    using u_end_node_ptr = std::unique_ptr<end_node_type>;
+
+    Node_Arena<node_type> nodes_;
+
+    u_end_node_ptr end_node_ = std::make_unique<end_node_type>();
+
+    node_ptr leftmost_  = end_node();
+    node_ptr rightmost_ = nullptr;
+
+    std::size_t size_ = 0;
+    std::size_t max_size_ = 0; // the greatest size since the whole tree has been rebuilt
+
+    double alpha_ = default_alpha;
+    double log_inv_alpha_ = -std::log (default_alpha);
+
+    std::uint64_t version_ = 0;
+    std::size_t n_rebuilds_ = 0;
+
+public:
+
+    SG_Tree () = default;
+
+    // alpha has to be in [0.5, 1)
+    explicit SG_Tree (double alpha) : alpha_{alpha}, log_inv_alpha_{-std::log (alpha)}
+    {
+        assert (0.5 <= alpha && alpha < 1.0);
+    }
+
+    // The copy is perfectly balanced
+    SG_Tree (const self &rhs) : alpha_{rhs.alpha_}, log_inv_alpha_{rhs.log_inv_alpha_}
+    {
+        std::vector<node_ptr> nodes;
+        nodes.reserve (rhs.size_);
+
+        for (auto &key : rhs)
+            nodes.push_back (insert_node (key));
+
+        link_balanced (root(), nodes);
+        max_size_ = size_ = nodes.size();
+    }
+
+    self &operator= (const self &rhs)
+    {
+        auto tmp_tree{rhs};
+        std::swap (*this, tmp_tree);
+
+        return *this;
+    }
+
+    SG_Tree (self &&rhs) noexcept
+            : nodes_{std::move (rhs.nodes_)},
+              end_node_{std::move (rhs.end_node_)},
+              leftmost_{std::exchange (rhs.leftmost_, rhs.end_node())},
+              rightmost_{std::exchange (rhs.rightmost_, nullptr)},
+              size_{std::exchange (rhs.size_, 0)},
+              max_size_{std::exchange (rhs.max_size_, 0)},
+              alpha_{rhs.alpha_},
+              log_inv_alpha_{rhs.log_inv_alpha_},
+              version_{rhs.version_++},
+              n_rebuilds_{std::exchange (rhs.n_rebuilds_, 0)} {}
+
+    self &operator= (self &&rhs) noexcept
+    {
+        std::swap (nodes_, rhs.nodes_);
+        std::swap (end_node_, rhs.end_node_);
+        std::swap (leftmost_, rhs.leftmost_);
+        std::swap (rightmost_, rhs.rightmost_);
+        std::swap (size_, rhs.size_);
+        std::swap (max_size_, rhs.max_size_);
+        std::swap (alpha_, rhs.alpha_);
+        std::swap (log_inv_alpha_, rhs.log_inv_alpha_);
+        std::swap (n_rebuilds_, rhs.n_rebuilds_);
+
+        // Both trees have changed, so neither may return to a version it has already had
+        version_ = rhs.version_ = std::max (version_, rhs.version_) + 1;
+
+        return *this;
+    }
+
+    ~SG_Tree () = default;
+
+    // Capacity
+
+    auto size () const { return size_; }
+    bool empty () const { return size_ == 0; }
+
+    // Results of queries made at the same version are the same
+    std::uint64_t version () const noexcept { return version_; }
+
+    double alpha () const noexcept { return alpha_; }
+
+    // Number of subtrees rebuilt so far, including rebuilds of the whole tree
+    size_type n_rebuilds () const noexcept { return n_rebuilds_; }
+
+    // Iterators
+
+    auto begin () { return iterator{leftmost_}; }
+    auto begin () const { return const_iterator{leftmost_}; }
+    auto cbegin () const { return const_iterator{leftmost_}; }
+
+    auto end () { return iterator{end_node()}; }
+    auto end () const { return const_iterator{end_node()}; }
+    auto cend () const { return const_iterator{end_node()}; }
+
+    // Modifiers
+
+    void swap (self &other) { std::swap (*this, other); }
+
+    std::pair<iterator, bool> insert (const key_type &key)
+    {
+        if (empty())
+        {
+            auto new_node = insert_node (key);
+
+            root() = new_node;
+            new_node->parent_ = end_node();
+            leftmost_ = rightmost_ = new_node;
+            size_ = max_size_ = 1;
+
+            return {iterator{new_node}, true};
+        }
+
+        node_ptr parent = nullptr;
+        std::size_t depth = 0;
+
+        for (auto node = root(); node; depth++)
+        {
+            if (key < node->key())
+            {
+                parent = node;
+                node = node->left_;
+            }
+            else if (node->key() < key)
+            {
+                parent = node;
+                node = node->right_;
+            }
+            else
+                return {iterator{node}, false};
+        }
+
+        auto new_node = insert_node (key);
+        new_node->parent_ = parent;
+
+        if (key < parent->key())
+        {
+            parent->left_ = new_node;
+            if (parent == leftmost_)
+                leftmost_ = new_node;
+        }
+        else
+        {
+            parent->right_ = new_node;
+            if (parent == rightmost_)
+                rightmost_ = new_node;
+        }
+
+        for (auto node = parent; node != end_node(); node = node->parent_)
+            node->size_++;
+
+        size_++;
+        max_size_ = std::max (max_size_, size_);
+
+        if (depth > std::log (static_cast<double>(size_)) / log_inv_alpha_)
+            rebuild_scapegoat (new_node);
+
+        return {iterator{new_node}, true};
+    }
+
+    // The hint is not used: the depth of the new node has to be known to keep the tree balanced
+    iterator insert (const_iterator, const key_type &key) { return insert (key).first; }
+
+    template<std::input_iterator it>
+    void insert (it first, it last)
+    {
+        for (; first != last; ++first)
+            insert (*first);
+    }
+
+    void insert (std::initializer_list<value_type> ilist) { insert (ilist.begin(), ilist.end()); }
+
+    // Returns the iterator following pos
+    iterator erase (const_iterator pos)
+    {
+        assert (pos != cend());
+
+        auto node = const_cast<node_ptr>(pos.base());
+        auto next = details::successor (node);
+
+        if (node == leftmost_)
+            leftmost_ = next;
+        if (node == rightmost_)
+            rightmost_ = (size_ == 1) ? nullptr : details::predecessor (node);
+
+        unlink (node);
+        nodes_.destroy (node);
+
+        size_--;
+        version_++;
+
+        if (size_ < alpha_ * max_size_)
+        {
+            if (!empty())
+                rebuild (root());
+            max_size_ = size_;
+        }
+
+        return iterator{next};
+    }
+
+    size_type erase (const key_type &key)
+    {
+        auto it = find (key);
+        if (it == end())
+            return 0;
+
+        erase (it);
+        return 1;
+    }
+
+    // Lookup
+
+    iterator find (const key_type &key)
+    {
+        auto node = details::find (root(), key);
+        return (node) ? iterator{node} : end();
+    }
+
+    const_iterator find (const key_type &key) const
+    {
+        auto node = details::find (root(), key);
+        return (node) ? const_iterator{node} : cend();
+    }
+
+    iterator lower_bound (const key_type &key)
+    {
+        auto node = details::lower_bound (root(), key);
+        return (node) ? iterator{node} : end();
+    }
+
+    const_iterator lower_bound (const key_type &key) const
+    {
+        auto node = details::lower_bound (root(), key);
+        return (node) ? const_iterator{node} : cend();
+    }
+
+    iterator upper_bound (const key_type &key)
+    {
+        auto node = details::upper_bound (root(), key);
+        return (node) ? iterator{node} : end();
+    }
+
+    const_iterator upper_bound (const key_type &key) const
+    {
+        auto node = details::upper_bound (root(), key);
+        return (node) ? const_iterator{node} : cend();
+    }
+
+    bool contains (const key_type &key) const { return find (key) != end(); }
+
+    // Order statistics
+
+    // k starts from 0; returns end() if k >= size()
+    iterator kth_smallest (size_type k)
+    {
+        auto node = details::kth_smallest (root(), k);
+        return (node) ? iterator{node} : end();
+    }
+
+    const_iterator kth_smallest (size_type k) const
+    {
+        auto node = details::kth_smallest (root(), k);
+        return (node) ? const_iterator{node} : cend();
+    }
+
+    size_type count_less (const key_type &key) const { return details::count_less (root(), key); }
+
+private:
+
+    node_ptr end_node () noexcept { return static_cast<node_ptr>(end_node_.get()); }
+    const_node_ptr end_node () const noexcept { return static_cast<node_ptr>(end_node_.get()); }
+
+    node_ptr &root () noexcept { return end_node()->left_; }
+    const_node_ptr root () const noexcept { return end_node()->left_; }
+
+    node_ptr insert_node (const key_type &key)
+    {
+        version_++;
+        return nodes_.construct (key);
+    }
+
+    // Points the link that holds the subtree to the root of nodes linked into a balanced tree
+    void link_balanced (node_ptr &link, const std::vector<node_ptr> &nodes)
+    {
+        auto parent = (link) ? link->parent_ : end_node();
+
+        link = details::build_balanced (nodes, 0, nodes.size());
+        if (link)
+            link->parent_ = parent;
+
+        if (!nodes.empty() && parent == end_node())
+        {
+            leftmost_ = nodes.front();
+            rightmost_ = nodes.back();
+        }
+    }
+
+    // Rebuilds the subtree of node into a perfectly balanced one in O(size) time. The leftmost
+    // and the rightmost nodes of the subtree stay the same. The buffer of nodes is local, so that
+    // a rebuild of the root does not leave the tree holding a pointer per key
+    void rebuild (node_ptr node)
+    {
+        std::vector<node_ptr> nodes;
+        nodes.reserve (node->size_);
+
+        auto first = details::minimum (node);
+        for (std::size_t i = 0, n = node->size_; i != n; ++i, first = details::successor (first))
+            nodes.push_back (first);
+
+        auto &link = (node->parent_ == end_node() || details::is_left_child (node))
+                   ? node->parent_->left_ : node->parent_->right_;
+
+        link_balanced (link, nodes);
+        n_rebuilds_++;
+    }
+
+    // Rebuilds the subtree of the nearest ancestor of node that is not alpha-weight-balanced.
+    // Such an ancestor exists if node is deeper than log (n) / log (1 / alpha)
+    void rebuild_scapegoat (node_ptr node)
+    {
+        for (auto parent = node->parent_; parent != end_node(); node = parent, parent = parent->parent_)
+            if (node->size_ > alpha_ * parent->size_)
+            {
+                rebuild (parent);
+                return;
+            }
+    }
+
+    // Replaces subtree rooted at node U with the subtree rooted at node V
+    void transplant (node_ptr u, node_ptr v)
+    {
+        if (u->parent_ == end_node())
+            root() = v;
+        else if (details::is_left_child (u))
+            u->parent_->left_ = v;
+        else
+            u->parent_->right_ = v;
+
+        if (v)
+            v->parent_ = u->parent_;
+    }
+
+    void unlink (node_ptr node)
+    {
+        node_ptr x_parent;
+
+        if (node->left_ == nullptr || node->right_ == nullptr)
+        {
+            x_parent = node->parent_;
+            transplant (node, (node->left_) ? node->left_ : node->right_);
+        }
+        else
+        {
+            // The successor takes the place of node
+            auto next = details::minimum (node->right_);
+
+            if (next->parent_ == node)
+                x_parent = next;
+            else
+            {
+                x_parent = next->parent_;
+                transplant (next, next->right_);
+                next->right_ = node->right_;
+                next->right_->parent_ = next;
+            }
+
+            transplant (node, next);
+            next->left_ = node->left_;
+            next->left_->parent_ = next;
+        }
+
+        // Subtrees that have lost a node are on the way from x_parent to the root
+        for (auto parent = x_parent; parent != end_node(); parent = parent->parent_)
+            parent->size_ = details::size (parent->left_) + details::size (parent->right_) + 1;
+    }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_SG_TREE_HPP
@@ -0,0 +1,573 @@
+#ifndef INCLUDE_SKIP_LIST_HPP
+#define INCLUDE_SKIP_LIST_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <optional>
+#include <random>
+#include <thread>
+#include <utility>
+
+#include "epoch.hpp"
+#include "key_iterator.hpp"
+
+namespace yLab
+{
+
+namespace details
+{
+
+// Reader-writer spin lock of a link. Updates that change the span of the link by one share it,
+// updates that relink it take it exclusively. A waiting writer keeps new readers out
+class Link_Lock final
+{
+    static constexpr std::uint32_t writer = std::uint32_t{1} << 31;
+
+    std::atomic<std::uint32_t> state_{0}; // writer bit and number of readers
+
+public:
+
+    void lock_shared () noexcept
+    {
+        while (state_.fetch_add (1, std::memory_order_acquire) & writer)
+        {
+            state_.fetch_sub (1, std::memory_order_relaxed);
+            while (state_.load (std::memory_order_relaxed) & writer)
+                std::this_thread::yield();
+        }
+    }
+
+    void unlock_shared () noexcept { state_.fetch_sub (1, std::memory_order_release); }
+
+    void lock () noexcept
+    {
+        while (state_.fetch_or (writer, std::memory_order_acquire) & writer)
+            while (state_.load (std::memory_order_relaxed) & writer)
+                std::this_thread::yield();
+
+        while (state_.load (std::memory_order_acquire) != writer)
+            std::this_thread::yield();
+    }
+
+    void unlock () noexcept { state_.fetch_and (~writer, std::memory_order_release); }
+};
+
+// Tower of a skip list. Its levels are allocated right after the node, so that a node of
+// height h takes exactly as much memory as it needs
+template <typename Key_T>
+struct SL_Node final
+{
+    struct Level final
+    {
+        std::atomic<SL_Node *> next{nullptr};
+
+        // Number of level 0 links passed by following next. The tail that follows the last
+        // node of every level is counted as one more node
+        std::atomic<std::size_t> span{0};
+
+        Link_Lock lock;
+    };
+
+    Key_T key_;
+    std::size_t height_;
+
+    std::atomic<bool> marked_{false};       // erased, but may still be linked on some levels
+    std::atomic<bool> fully_linked_{false}; // linked on every level
+
+    SL_Node (const Key_T &key, std::size_t height) : key_{key}, height_{height} {}
+
+    Level &level (std::size_t i) noexcept
+    {
+        return std::launder (reinterpret_cast<Level *>(this + 1))[i];
+    }
+
+    static SL_Node *create (const Key_T &key, std::size_t height)
+    {
+        static_assert (sizeof (SL_Node) % alignof (Level) == 0);
+
+        auto memory = ::operator new (sizeof (SL_Node) + height * sizeof (Level));
+
+        SL_Node *node;
+        try
+        {
+            node = new (memory) SL_Node (key, height);
+        }
+        catch (...)
+        {
+            ::operator delete (memory);
+            throw;
+        }
+
+        for (std::size_t i = 0; i != height; ++i)
+            new (reinterpret_cast<Level *>(node + 1) + i) Level{};
+
+        return node;
+    }
+
+    static void destroy (SL_Node *node) noexcept
+    {
+        for (std::size_t i = 0; i != node->height_; ++i)
+            node->level (i).~Level();
+
+        node->~SL_Node();
+        ::operator delete (node);
+    }
+};
+
+} // namespace details
+
+/*
+ * Concurrent skip list with order statistics. Membership follows the lazy skip list (Herlihy,
+ * Lev, Luchangco, Shavit, 2007): lookups do not lock anything, insert() and erase() lock the
+ * links from the predecessors of the key on the levels of the node, validate that they still
+ * lead to the same successors and then link or unlink the node. Erased nodes are reclaimed
+ * through epoch-based reclamation.
+ *
+ * Each link also stores its span, the number of level 0 links it passes, as in an indexable skip
+ * list, so count_less() and kth_smallest() take O(log n) time. Above the height of its node an
+ * update only adds or subtracts one from the span of the link that passes over the key, so it
+ * takes these links shared (see Link_Lock) and changes their spans by atomic fetch_add() and
+ * fetch_sub(). Such updates do not wait for each other even if they share the predecessor on
+ * a high level (typically the head); they only wait for an update that relinks the same link.
+ * A shared link keeps the spans below it stable for the node that relinks it, which computes
+ * the spans of the new links from them.
+ *
+ * Order statistics, size() and iteration are exact when no update is in progress and weakly
+ * consistent otherwise. Iterators hold a copy of a key (see key_iterator).
+ */
+template <typename Key_T>
+class Concurrent_Skip_List final
+{
+public:
+
+    using key_type = Key_T;
+    using value_type = key_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using node_type = details::SL_Node<key_type>;
+    using const_iterator = key_iterator<Concurrent_Skip_List>;
+    using iterator = const_iterator;
+
+    static constexpr size_type max_height = 16;
+
+private:
+
+    using self = Concurrent_Skip_List<key_type>;
+    using node_ptr = node_type *;
+    using path_type = std::array<node_ptr, max_height>;
+
+    friend const_iterator;
+
+    // Locks the links from the predecessors of a node: exclusively on the levels of the node,
+    // where the links of the victim of an erasure are locked as well, and shared above them.
+    // Links are locked level by level from the top and by ascending keys within a level, so
+    // locking cannot deadlock
+    class Path_Lock final
+    {
+        const path_type &preds_;
+        size_type height_;
+        node_ptr victim_;
+
+    public:
+
+        Path_Lock (const path_type &preds, size_type height, node_ptr victim = nullptr)
+            : preds_{preds}, height_{height}, victim_{victim}
+        {
+            for (auto i = max_height; i-- != 0;)
+            {
+                if (i < height_)
+                {
+                    preds_[i]->level (i).lock.lock();
+                    if (victim_)
+                        victim_->level (i).lock.lock();
+                }
+                else
+                    preds_[i]->level (i).lock.lock_shared();
+            }
+        }
+
+        Path_Lock (const Path_Lock &rhs) = delete;
+        Path_Lock &operator= (const Path_Lock &rhs) = delete;
+
+        ~Path_Lock ()
+        {
+            for (size_type i = 0; i != max_height; ++i)
+            {
+                if (i < height_)
+                {
+                    if (victim_)
+                        victim_->level (i).lock.unlock();
+                    preds_[i]->level (i).lock.unlock();
+                }
+                else
+                    preds_[i]->level (i).lock.unlock_shared();
+            }
+        }
+    };
+
+    mutable Epoch_Domain epoch_;
+    node_ptr head_;
+
+public:
+
+    Concurrent_Skip_List () : head_{node_type::create (key_type{}, max_height)}
+    {
+        for (size_type i = 0; i != max_height; ++i)
+            head_->level (i).span = 1;
+        head_->fully_linked_ = true;
+    }
+
+    Concurrent_Skip_List (const self &rhs) = delete;
+    self &operator= (const self &rhs) = delete;
+
+    // No other thread may access the list
+    ~Concurrent_Skip_List ()
+    {
+        for (auto node = head_; node;)
+        {
+            auto next = node->level (0).next.load();
+            node_type::destroy (node);
+            node = next;
+        }
+    }
+
+    // Capacity
+
+    size_type size () const { return head_->level (max_height - 1).span.load() - 1; }
+    bool empty () const { return size() == 0; }
+
+    // Iterators
+
+    const_iterator begin () const
+    {
+        auto guard = epoch_.pin();
+        return const_iterator{this, first_key (head_)};
+    }
+
+    const_iterator cbegin () const { return begin(); }
+
+    const_iterator end () const { return const_iterator{this, std::nullopt}; }
+    const_iterator cend () const { return end(); }
+
+    // Modifiers
+
+    std::pair<iterator, bool> insert (const key_type &key)
+    {
+        auto height = random_height();
+        auto guard = epoch_.pin();
+
+        path_type preds, succs;
+        for (;;)
+        {
+            if (auto node = find (key, preds, succs))
+            {
+                if (node->marked_.load())
+                    continue; // Wait until it is unlinked
+
+                while (!node->fully_linked_.load())
+                    std::this_thread::yield();
+
+                return {iterator{this, key}, false};
+            }
+
+            Path_Lock lock{preds, height};
+
+            if (!is_valid (preds, succs, height))
+                continue;
+
+            auto distances = distances_to_bottom (preds, height);
+            auto new_node = node_type::create (key, height);
+
+            for (size_type i = 0; i != max_height; ++i)
+            {
+                auto &pred_level = preds[i]->level (i);
+
+                if (i < height)
+                {
+                    auto &new_level = new_node->level (i);
+                    new_level.next = succs[i];
+                    new_level.span = pred_level.span.load() - distances[i];
+
+                    pred_level.span = distances[i] + 1;
+                    pred_level.next = new_node;
+                }
+                else
+                    pred_level.span.fetch_add (1);
+            }
+
+            new_node->fully_linked_ = true;
+            return {iterator{this, key}, true};
+        }
+    }
+
+    template<std::input_iterator it>
+    void insert (it first, it last)
+    {
+        for (; first != last; ++first)
+            insert (*first);
+    }
+
+    size_type erase (const key_type &key)
+    {
+        auto guard = epoch_.pin();
+
+        path_type preds, succs;
+        node_ptr victim = nullptr;
+
+        for (;;)
+        {
+            auto node = find (key, preds, succs);
+
+            if (!victim)
+            {
+                // A node that is not fully linked is still being inserted
+                if (!node || !node->fully_linked_.load() || node->marked_.load())
+                    return 0;
+
+                // The key is erased from now on, the rest is unlinking
+                if (node->marked_.exchange (true))
+                    return 0;
+                victim = node;
+            }
+
+            {
+                Path_Lock lock{preds, victim->height_, victim};
+
+                if (!is_valid (preds, succs, victim->height_, victim))
+                    continue;
+
+                for (size_type i = 0; i != max_height; ++i)
+                {
+                    auto &pred_level = preds[i]->level (i);
+
+                    if (i < victim->height_)
+                    {
+                        auto &victim_level = victim->level (i);
+                        pred_level.span = pred_level.span.load() + victim_level.span.load() - 1;
+                        pred_level.next = victim_level.next.load();
+                    }
+                    else
+                        pred_level.span.fetch_sub (1);
+                }
+            }
+
+            epoch_.retire (guard, victim, &reclaim, nullptr);
+
+            return 1;
+        }
+    }
+
+    // Lookup
+
+    const_iterator find (const key_type &key) const
+    {
+        return contains (key) ? const_iterator{this, key} : end();
+    }
+
+    const_iterator lower_bound (const key_type &key) const
+    {
+        return const_iterator{this, bound (key, false)};
+    }
+
+    const_iterator upper_bound (const key_type &key) const
+    {
+        return const_iterator{this, bound (key, true)};
+    }
+
+    bool contains (const key_type &key) const
+    {
+        auto guard = epoch_.pin();
+
+        auto node = last_before (key, false)->level (0).next.load();
+        return node && !(key < node->key_) && node->fully_linked_.load() && !node->marked_.load();
+    }
+
+    // Order statistics
+
+    // k starts from 0; returns end() if k >= size()
+    const_iterator kth_smallest (size_type k) const
+    {
+        auto guard = epoch_.pin();
+
+        auto target = k + 1; // The head has rank 0
+        size_type rank = 0;
+
+        auto node = head_;
+        for (auto i = max_height; i-- != 0;)
+        {
+            for (;;)
+            {
+                auto &level = node->level (i);
+                auto next = level.next.load();
+                auto span = level.span.load();
+
+                if (!next || rank + span > target)
+                    break;
+
+                rank += span;
+                node = next;
+            }
+        }
+
+        return (node != head_ && rank == target) ? const_iterator{this, node->key_} : end();
+    }
+
+    size_type count_less (const key_type &key) const
+    {
+        auto guard = epoch_.pin();
+
+        size_type rank = 0;
+
+        auto node = head_;
+        for (auto i = max_height; i-- != 0;)
+        {
+            for (;;)
+            {
+                auto &level = node->level (i);
+                auto next = level.next.load();
+
+                if (!next || !(next->key_ < key))
+                    break;
+
+                rank += level.span.load();
+                node = next;
+            }
+        }
+
+        return rank;
+    }
+
+private:
+
+    static void reclaim (void *, void *object) { node_type::destroy (static_cast<node_ptr>(object)); }
+
+    static size_type random_height ()
+    {
+        thread_local std::minstd_rand gen{std::random_device{}()};
+
+        size_type height = 1;
+        while (height != max_height && gen() % 4 == 0)
+            height++;
+
+        return height;
+    }
+
+    // Fills predecessors and successors of key on every level. Returns the node with the key
+    // if there is one
+    node_ptr find (const key_type &key, path_type &preds, path_type &succs) const
+    {
+        node_ptr found = nullptr;
+
+        auto pred = head_;
+        for (auto i = max_height; i-- != 0;)
+        {
+            auto curr = pred->level (i).next.load();
+            while (curr && curr->key_ < key)
+            {
+                pred = curr;
+                curr = pred->level (i).next.load();
+            }
+
+            if (!found && curr && !(key < curr->key_))
+                found = curr;
+
+            preds[i] = pred;
+            succs[i] = curr;
+        }
+
+        return found;
+    }
+
+    // The links from the predecessors have to be locked. For insertion, the new node of the given height has
+    // to fit between predecessors and successors. For erasure, the victim has to follow its
+    // predecessors on its levels
+    bool is_valid (const path_type &preds, const path_type &succs, size_type height,
+                   node_ptr victim = nullptr) const
+    {
+        for (size_type i = 0; i != max_height; ++i)
+        {
+            auto pred = preds[i];
+            if (pred->marked_.load())
+                return false;
+
+            auto next = pred->level (i).next.load();
+
+            if (i < height && victim)
+            {
+                if (next != victim)
+                    return false;
+            }
+            else if (next != succs[i] || (i < height && next && next->marked_.load()))
+                return false;
+        }
+
+        return true;
+    }
+
+    // distances[i] is the number of level 0 links between preds[i] and preds[0] for i < height.
+    // The links from the predecessors on these levels have to be locked exclusively: any update
+    // between preds[i] and preds[0] locks the link from preds[i] until it is done, so the links
+    // followed here do not change
+    std::array<size_type, max_height> distances_to_bottom (const path_type &preds,
+                                                           size_type height) const
+    {
+        std::array<size_type, max_height> distances{};
+
+        for (size_type i = 1; i < height; ++i)
+        {
+            auto distance = distances[i - 1];
+            for (auto node = preds[i]; node != preds[i - 1]; node = node->level (i - 1).next.load())
+                distance += node->level (i - 1).span.load();
+
+            distances[i] = distance;
+        }
+
+        return distances;
+    }
+
+    // The last node with a key less than (or not greater than if inclusive) key
+    node_ptr last_before (const key_type &key, bool inclusive) const
+    {
+        auto node = head_;
+        for (auto i = max_height; i-- != 0;)
+        {
+            for (;;)
+            {
+                auto next = node->level (i).next.load();
+                if (!next || (inclusive ? key < next->key_ : !(next->key_ < key)))
+                    break;
+
+                node = next;
+            }
+        }
+
+        return node;
+    }
+
+    // The first key after the node that has been neither erased nor is still being inserted
+    std::optional<key_type> first_key (node_ptr node) const
+    {
+        for (node = node->level (0).next.load(); node; node = node->level (0).next.load())
+            if (node->fully_linked_.load() && !node->marked_.load())
+                return node->key_;
+
+        return std::nullopt;
+    }
+
+    // The least key that is greater than (strict) or not less than key
+    std::optional<key_type> bound (const key_type &key, bool strict) const
+    {
+        auto guard = epoch_.pin();
+        return first_key (last_before (key, strict));
+    }
+
+    std::optional<key_type> next_key (const key_type &key) const { return bound (key, true); }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_SKIP_LIST_HPP
@@ -0,0 +1,222 @@
+#ifndef INCLUDE_SUCCINCT_TREE_HPP
+#define INCLUDE_SUCCINCT_TREE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <queue>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "bit_vector.hpp"
+
+namespace yLab
+{
+
+/*
+ * Frozen copy of an RB_Tree in a succinct level-order encoding (LOUDS for binary trees, Jacobson,
+ * 1989). Nodes are numbered in level order starting from 0 at the root. Bits 2i and 2i + 1 of the
+ * shape tell whether node i has the left and the right child, and keys are packed in level order,
+ * so the tree takes 2 bits per node for its shape (2.25 with the rank directory) besides the keys
+ * themselves. Navigation is done with rank and select over the shape:
+ *
+ *     left (i)   = rank1 (2i) + 1
+ *     right (i)  = rank1 (2i + 1) + 1
+ *     parent (i) = select1 (i - 1) / 2
+ *
+ * The shape of the original tree is preserved, so lookups visit the same number of nodes.
+ */
+template <typename Key_T>
+class Succinct_Tree final
+{
+public:
+
+    using key_type = Key_T;
+    using value_type = key_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+private:
+
+    Bit_Vector shape_;
+    std::vector<key_type> keys_; // in level order
+
+public:
+
+    Succinct_Tree () = default;
+
+    explicit Succinct_Tree (const RB_Tree<key_type> &tree)
+    {
+        using node_ptr = const RB_Node<key_type> *;
+
+        std::vector<bool> shape;
+        shape.reserve (2 * tree.size());
+        keys_.reserve (tree.size());
+
+        std::queue<node_ptr> queue;
+        if (auto root = tree.end().base()->left_)
+            queue.push (root);
+
+        for (; !queue.empty(); queue.pop())
+        {
+            auto node = queue.front();
+            keys_.push_back (node->key());
+
+            shape.push_back (node->left_ != nullptr);
+            shape.push_back (node->right_ != nullptr);
+
+            if (node->left_)
+                queue.push (node->left_);
+            if (node->right_)
+                queue.push (node->right_);
+        }
+
+        shape_ = Bit_Vector{shape};
+    }
+
+    // Capacity
+
+    size_type size () const noexcept { return keys_.size(); }
+    bool empty () const noexcept { return keys_.empty(); }
+
+    // Bytes taken by the shape and the keys
+    size_type size_in_bytes () const noexcept
+    {
+        return shape_.size_in_bytes() + keys_.size() * sizeof (key_type);
+    }
+
+    // Iterators
+
+    const_iterator begin () const
+    {
+        return empty() ? end() : const_iterator{this, leftmost (0)};
+    }
+
+    const_iterator end () const { return const_iterator{this, size()}; }
+
+    const_iterator cbegin () const { return begin(); }
+    const_iterator cend () const { return end(); }
+
+    // Lookup
+
+    const_iterator find (const key_type &key) const
+    {
+        for (size_type i = 0; i != size();)
+        {
+            if (key < keys_[i])
+                i = has_left (i) ? left (i) : size();
+            else if (keys_[i] < key)
+                i = has_right (i) ? right (i) : size();
+            else
+                return const_iterator{this, i};
+        }
+
+        return end();
+    }
+
+    const_iterator lower_bound (const key_type &key) const { return bound (key, false); }
+    const_iterator upper_bound (const key_type &key) const { return bound (key, true); }
+
+    bool contains (const key_type &key) const { return find (key) != end(); }
+
+private:
+
+    bool has_left (size_type i) const { return shape_[2 * i]; }
+    bool has_right (size_type i) const { return shape_[2 * i + 1]; }
+
+    size_type left (size_type i) const { return shape_.rank1 (2 * i) + 1; }
+    size_type right (size_type i) const { return shape_.rank1 (2 * i + 1) + 1; }
+
+    size_type leftmost (size_type i) const
+    {
+        while (has_left (i))
+            i = left (i);
+
+        return i;
+    }
+
+    // In-order successor of node i or size() if there is none
+    size_type successor (size_type i) const
+    {
+        if (has_right (i))
+            return leftmost (right (i));
+
+        while (i != 0)
+        {
+            // The bit of the parent that points to node i
+            auto bit = shape_.select1 (i - 1);
+            i = bit / 2;
+
+            if (bit % 2 == 0) // Node i has been the left child
+                return i;
+        }
+
+        return size();
+    }
+
+    // The first key that is greater than (strict) or not less than key
+    const_iterator bound (const key_type &key, bool strict) const
+    {
+        auto result = size();
+
+        for (size_type i = 0; i != size();)
+        {
+            if (strict ? key < keys_[i] : !(keys_[i] < key))
+            {
+                result = i;
+                i = has_left (i) ? left (i) : size();
+            }
+            else
+                i = has_right (i) ? right (i) : size();
+        }
+
+        return const_iterator{this, result};
+    }
+
+public:
+
+    class const_iterator final
+    {
+    public:
+
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = Key_T;
+        using reference = const Key_T &;
+        using pointer = const Key_T *;
+
+    private:
+
+        const Succinct_Tree *tree_ = nullptr;
+        size_type i_ = 0; // level order number of the node
+
+    public:
+
+        const_iterator () = default;
+        const_iterator (const Succinct_Tree *tree, size_type i) : tree_{tree}, i_{i} {}
+
+        reference operator* () const { return tree_->keys_[i_]; }
+        pointer operator-> () const { return &tree_->keys_[i_]; }
+
+        const_iterator &operator++ ()
+        {
+            i_ = tree_->successor (i_);
+            return *this;
+        }
+
+        const_iterator operator++ (int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator== (const const_iterator &rhs) const { return i_ == rhs.i_; }
+    };
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_SUCCINCT_TREE_HPP
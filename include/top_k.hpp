@@ -0,0 +1,88 @@
+#ifndef INCLUDE_TOP_K_HPP
+#define INCLUDE_TOP_K_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+/*
+ * The k greatest distinct keys of a stream. Once k keys are kept, a key that is not greater than
+ * the least of them is rejected after one comparison with the leftmost node of the tree. A key
+ * that qualifies replaces the least one in O(log k) time. The slot of the evicted node is reused
+ * by the next key that qualifies, so a full container does not allocate memory.
+ */
+template <typename Key_T>
+class Top_K final
+{
+public:
+
+    using tree_type = RB_Tree<Key_T>;
+    using key_type = typename tree_type::key_type;
+    using value_type = typename tree_type::value_type;
+    using size_type = typename tree_type::size_type;
+    using const_iterator = typename tree_type::const_iterator;
+
+private:
+
+    tree_type tree_;
+    size_type capacity_;
+
+public:
+
+    explicit Top_K (size_type capacity) : capacity_{std::max<size_type>(capacity, 1)} {}
+
+    size_type capacity () const noexcept { return capacity_; }
+    size_type size () const { return tree_.size(); }
+    bool empty () const { return tree_.empty(); }
+    bool full () const { return tree_.size() == capacity_; }
+
+    // The least of the kept keys. The container must not be empty
+    const key_type &min () const
+    {
+        assert (!empty());
+        return *tree_.begin();
+    }
+
+    // Returns true if the key is kept
+    bool insert (const key_type &key)
+    {
+        if (!full())
+            return tree_.insert (key).second;
+
+        if (!(*tree_.begin() < key))
+            return false;
+
+        // The key is inserted first, so that a key which is already kept does not evict the minimum
+        if (!tree_.insert (key).second)
+            return false;
+
+        tree_.erase (tree_.cbegin());
+        return true;
+    }
+
+    template<std::input_iterator it>
+    void insert (it first, it last)
+    {
+        for (; first != last; ++first)
+            insert (*first);
+    }
+
+    bool contains (const key_type &key) const { return tree_.contains (key); }
+
+    // Kept keys in ascending order
+
+    const_iterator begin () const { return tree_.begin(); }
+    const_iterator end () const { return tree_.end(); }
+
+    const tree_type &tree () const noexcept { return tree_; }
+};
+
+} // namespace yLab
+
+#endif // INCLUDE_TOP_K_HPP
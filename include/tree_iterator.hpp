@@ -2,6 +2,7 @@
 #define INCLUDE_TREE_ITERATOR
 
 #include <iterator>
+#include <type_traits>
 
 #include "details.hpp"
 
@@ -31,6 +32,11 @@ public:
     tree_iterator () = default;
     tree_iterator (node_ptr node) : node_{node} {}
 
+    // Makes iterator convertible to const_iterator
+    template <typename Other_Node_T>
+    requires (!std::is_same_v<Other_Node_T, Node_T> && std::is_convertible_v<Other_Node_T *, node_ptr>)
+    tree_iterator (const tree_iterator<Key_T, Other_Node_T> &rhs) : node_{rhs.base()} {}
+
     reference operator* () const { return node_->key(); }
     pointer operator-> () const { return &node_->key(); }
 
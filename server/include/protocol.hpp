@@ -0,0 +1,60 @@
+#ifndef INCLUDE_PROTOCOL_HPP
+#define INCLUDE_PROTOCOL_HPP
+
+#include <cstdint>
+
+namespace yLab
+{
+
+/*
+ * Wire format of the query server. Both peers live on the same host (UNIX domain socket),
+ * so messages are fixed-size structures in host byte order. Responses are sent back on the
+ * same connection in the order the requests were received.
+ */
+namespace protocol
+{
+
+using key_type = std::int64_t;
+
+enum class Opcode : std::uint8_t
+{
+    find,        // value = key if it is in the set
+    lower_bound, // value = first element not less than key
+    rank,        // value = number of elements less than key
+    kth,         // value = k-th smallest element (k starts from 0)
+    insert       // value = 1 if the key was inserted, 0 if it was already in the set
+};
+
+enum class Status : std::uint8_t
+{
+    ok,
+    not_found,
+    bad_request
+};
+
+struct Request final
+{
+    std::uint32_t tag;
+    Opcode opcode;
+    std::uint8_t padding[3];
+    key_type operand;
+};
+
+struct Response final
+{
+    std::uint32_t tag;
+    Status status;
+    std::uint8_t padding[3];
+    key_type value;
+};
+
+static_assert (sizeof (Request) == 16);
+static_assert (sizeof (Response) == 16);
+
+inline constexpr const char *default_socket_path = "/tmp/yLab_tree.sock";
+
+} // namespace protocol
+
+} // namespace yLab
+
+#endif // INCLUDE_PROTOCOL_HPP
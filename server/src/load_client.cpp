@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "protocol.hpp"
+
+namespace
+{
+
+using namespace yLab::protocol;
+using clock_type = std::chrono::steady_clock;
+
+struct Options final
+{
+    std::string path = default_socket_path;
+    std::size_t n_connections = 4;
+    std::size_t n_requests = 100'000; // per connection
+    std::size_t depth = 16;           // requests in flight per connection
+    double insert_ratio = 0.1;
+    key_type key_range = 1'000'000;
+};
+
+[[noreturn]] void throw_errno (const std::string &what)
+{
+    throw std::system_error{errno, std::generic_category(), what};
+}
+
+void usage (std::ostream &os)
+{
+    os << "Usage: load_client [--socket PATH] [--connections N] [--requests N] [--depth N]\n"
+          "                   [--insert-ratio P] [--key-range N]\n";
+}
+
+Options parse_options (int argc, char **argv)
+{
+    Options options;
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        std::string option = argv[i];
+        if (option == "--help")
+        {
+            usage (std::cout);
+            std::exit (0);
+        }
+
+        if (i + 1 == argc)
+            throw std::invalid_argument{"missing value of " + option};
+        std::string value = argv[++i];
+
+        if (option == "--socket")
+            options.path = value;
+        else if (option == "--connections")
+            options.n_connections = std::stoul (value);
+        else if (option == "--requests")
+            options.n_requests = std::stoul (value);
+        else if (option == "--depth")
+            options.depth = std::stoul (value);
+        else if (option == "--insert-ratio")
+            options.insert_ratio = std::stod (value);
+        else if (option == "--key-range")
+            options.key_range = std::stoll (value);
+        else
+            throw std::invalid_argument{"unknown option " + option};
+    }
+
+    if (options.n_connections == 0 || options.depth == 0 || options.key_range <= 0)
+        throw std::invalid_argument{"connections, depth and key range have to be positive"};
+
+    return options;
+}
+
+int connect_to (const std::string &path)
+{
+    auto fd = ::socket (AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+        throw_errno ("socket");
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof (addr.sun_path))
+        throw std::invalid_argument{"socket path is too long"};
+    std::strcpy (addr.sun_path, path.c_str());
+
+    if (::connect (fd, reinterpret_cast<sockaddr *>(&addr), sizeof (addr)) == -1)
+    {
+        ::close (fd);
+        throw_errno ("connect");
+    }
+
+    return fd;
+}
+
+void write_all (int fd, const void *data, std::size_t n_bytes)
+{
+    auto bytes = static_cast<const char *>(data);
+    while (n_bytes)
+    {
+        auto n_written = ::send (fd, bytes, n_bytes, MSG_NOSIGNAL);
+        if (n_written == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            throw_errno ("send");
+        }
+
+        bytes += n_written;
+        n_bytes -= n_written;
+    }
+}
+
+void read_all (int fd, void *data, std::size_t n_bytes)
+{
+    auto bytes = static_cast<char *>(data);
+    while (n_bytes)
+    {
+        auto n_read = ::read (fd, bytes, n_bytes);
+        if (n_read == 0)
+            throw std::runtime_error{"server closed the connection"};
+        if (n_read == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            throw_errno ("read");
+        }
+
+        bytes += n_read;
+        n_bytes -= n_read;
+    }
+}
+
+// Keeps options.depth requests in flight and records the latency of each of them in microseconds
+void run_connection (const Options &options, unsigned seed, std::vector<double> &latencies)
+{
+    auto fd = connect_to (options.path);
+
+    std::mt19937_64 gen{seed};
+    std::uniform_int_distribution<key_type> key_dist{0, options.key_range - 1};
+    std::bernoulli_distribution insert_dist{options.insert_ratio};
+    std::uniform_int_distribution<int> lookup_dist{0, 3};
+
+    auto make_request = [&](std::uint32_t tag)
+    {
+        Request request{};
+        request.tag = tag;
+        request.opcode = insert_dist (gen) ? Opcode::insert : static_cast<Opcode>(lookup_dist (gen));
+        request.operand = key_dist (gen);
+        if (request.opcode == Opcode::kth)
+            request.operand %= std::max<key_type>(options.key_range / 2, 1);
+
+        return request;
+    };
+
+    std::vector<clock_type::time_point> sent_at (options.n_requests);
+    latencies.reserve (options.n_requests);
+
+    std::size_t n_sent = 0;
+    auto send_request = [&]()
+    {
+        auto request = make_request (static_cast<std::uint32_t>(n_sent));
+        sent_at[n_sent++] = clock_type::now();
+        write_all (fd, &request, sizeof (request));
+    };
+
+    try
+    {
+        while (n_sent < std::min (options.depth, options.n_requests))
+            send_request();
+
+        for (std::size_t n_received = 0; n_received != options.n_requests; ++n_received)
+        {
+            Response response;
+            read_all (fd, &response, sizeof (response));
+
+            std::chrono::duration<double, std::micro> latency = clock_type::now() - sent_at[response.tag];
+            latencies.push_back (latency.count());
+
+            if (n_sent != options.n_requests)
+                send_request();
+        }
+    }
+    catch (...)
+    {
+        ::close (fd);
+        throw;
+    }
+
+    ::close (fd);
+}
+
+double percentile (std::vector<double> &values, double fraction)
+{
+    if (values.empty())
+        return 0.0;
+
+    auto nth = values.begin() + static_cast<std::ptrdiff_t>(fraction * (values.size() - 1));
+    std::nth_element (values.begin(), nth, values.end());
+
+    return *nth;
+}
+
+} // unnamed namespace
+
+int main (int argc, char **argv)
+{
+    try
+    {
+        auto options = parse_options (argc, argv);
+
+        std::vector<std::vector<double>> latencies (options.n_connections);
+        std::vector<std::exception_ptr> errors (options.n_connections);
+
+        auto start = clock_type::now();
+        {
+            std::vector<std::jthread> threads;
+            for (std::size_t i = 0; i != options.n_connections; ++i)
+                threads.emplace_back ([&, i]()
+                {
+                    try { run_connection (options, static_cast<unsigned>(i + 1), latencies[i]); }
+                    catch (...) { errors[i] = std::current_exception(); }
+                });
+        }
+        std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+        for (auto &error : errors)
+            if (error)
+                std::rethrow_exception (error);
+
+        std::vector<double> all;
+        for (auto &connection_latencies : latencies)
+            all.insert (all.end(), connection_latencies.begin(), connection_latencies.end());
+
+        std::cout << "Requests:   " << all.size() << " over " << options.n_connections << " connections\n"
+                  << "Elapsed:    " << elapsed.count() << " s\n"
+                  << "Throughput: " << all.size() / elapsed.count() << " requests/s\n"
+                  << "p50:        " << percentile (all, 0.50) << " us\n"
+                  << "p99:        " << percentile (all, 0.99) << " us" << std::endl;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "load_client: " << e.what() << std::endl;
+        usage (std::cerr);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,502 @@
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "rb_tree.hpp"
+#include "protocol.hpp"
+
+namespace
+{
+
+using namespace yLab::protocol;
+
+volatile std::sig_atomic_t stop_requested = 0;
+
+void on_signal (int) { stop_requested = 1; }
+
+[[noreturn]] void throw_errno (const std::string &what)
+{
+    throw std::system_error{errno, std::generic_category(), what};
+}
+
+class File_Descriptor final
+{
+    int fd_ = -1;
+
+public:
+
+    explicit File_Descriptor (int fd) : fd_{fd} {}
+
+    File_Descriptor (const File_Descriptor &rhs) = delete;
+    File_Descriptor &operator= (const File_Descriptor &rhs) = delete;
+
+    ~File_Descriptor () { if (fd_ != -1) ::close (fd_); }
+
+    int get () const noexcept { return fd_; }
+};
+
+struct Connection final
+{
+    File_Descriptor fd;
+
+    std::vector<char> input;
+    std::vector<Response> output;
+    std::size_t n_sent_bytes = 0;
+    bool waits_for_epollout = false;
+    bool peer_closed = false; // the peer sends no more requests, but waits for the responses
+
+    explicit Connection (int fd_) : fd{fd_} {}
+};
+
+// A request taken from a connection together with the slot of its response
+struct Pending_Request final
+{
+    Request request;
+    Connection *conn;
+    std::size_t response_i;
+    std::size_t phase = 0; // see Server::execute_batch()
+
+    Response &response () const { return conn->output[response_i]; }
+};
+
+class Server final
+{
+    using tree_type = yLab::RB_Tree<key_type>;
+
+    tree_type tree_;
+
+    std::string path_;
+    File_Descriptor listener_;
+    File_Descriptor epoll_;
+
+    std::unordered_map<int, std::unique_ptr<Connection>> connections_;
+
+    std::vector<Pending_Request> batch_;
+
+    std::size_t n_batches_ = 0;
+    std::size_t n_requests_ = 0;
+
+public:
+
+    explicit Server (const std::string &path)
+        : path_{path},
+          listener_{::socket (AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)},
+          epoll_{::epoll_create1 (EPOLL_CLOEXEC)}
+    {
+        if (listener_.get() == -1)
+            throw_errno ("socket");
+        if (epoll_.get() == -1)
+            throw_errno ("epoll_create1");
+
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path_.size() >= sizeof (addr.sun_path))
+            throw std::invalid_argument{"socket path is too long"};
+        std::strcpy (addr.sun_path, path_.c_str());
+
+        ::unlink (path_.c_str());
+        if (::bind (listener_.get(), reinterpret_cast<sockaddr *>(&addr), sizeof (addr)) == -1)
+            throw_errno ("bind");
+        if (::listen (listener_.get(), SOMAXCONN) == -1)
+            throw_errno ("listen");
+
+        watch (listener_.get(), EPOLLIN);
+    }
+
+    Server (const Server &rhs) = delete;
+    Server &operator= (const Server &rhs) = delete;
+
+    ~Server () { ::unlink (path_.c_str()); }
+
+    void run ()
+    {
+        constexpr int max_events = 256;
+        epoll_event events[max_events];
+
+        while (!stop_requested)
+        {
+            auto n_events = ::epoll_wait (epoll_.get(), events, max_events, -1);
+            if (n_events == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw_errno ("epoll_wait");
+            }
+
+            // Gather requests from every ready connection first, so that the requests which
+            // arrived concurrently are served as one batch
+            std::vector<Connection *> ready;
+            for (auto i = 0; i != n_events; ++i)
+            {
+                auto fd = events[i].data.fd;
+                if (fd == listener_.get())
+                {
+                    accept_all();
+                    continue;
+                }
+
+                auto conn_it = connections_.find (fd);
+                if (conn_it == connections_.end())
+                    continue;
+                auto conn = conn_it->second.get();
+
+                if (events[i].events & EPOLLERR)
+                {
+                    close_connection (conn);
+                    continue;
+                }
+
+                // On hangup, the requests sent before it may still be unread
+                if ((events[i].events & (EPOLLIN | EPOLLHUP)) && !conn->peer_closed && !receive (conn))
+                {
+                    close_connection (conn);
+                    continue;
+                }
+
+                ready.push_back (conn);
+            }
+
+            execute_batch();
+
+            // A connection closed by the peer is closed here once all its responses are sent
+            for (auto conn : ready)
+                if (!send (conn) || (conn->peer_closed && conn->output.empty()))
+                    close_connection (conn);
+        }
+    }
+
+    void print_statistics (std::ostream &os) const
+    {
+        os << "Served " << n_requests_ << " requests in " << n_batches_ << " batches";
+        if (n_batches_)
+            os << " (" << static_cast<double>(n_requests_) / n_batches_ << " requests per batch)";
+        os << "; the set holds " << tree_.size() << " keys" << std::endl;
+    }
+
+private:
+
+    void watch (int fd, std::uint32_t events)
+    {
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = fd;
+
+        if (::epoll_ctl (epoll_.get(), EPOLL_CTL_ADD, fd, &event) == -1)
+            throw_errno ("epoll_ctl");
+    }
+
+    void rewatch (int fd, std::uint32_t events)
+    {
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = fd;
+
+        if (::epoll_ctl (epoll_.get(), EPOLL_CTL_MOD, fd, &event) == -1)
+            throw_errno ("epoll_ctl");
+    }
+
+    void accept_all ()
+    {
+        for (;;)
+        {
+            auto fd = ::accept4 (listener_.get(), nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd == -1)
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNABORTED)
+                    return;
+                if (errno == EINTR)
+                    continue;
+                throw_errno ("accept4");
+            }
+
+            auto conn = std::make_unique<Connection>(fd);
+            watch (fd, EPOLLIN);
+            connections_.emplace (fd, std::move (conn));
+        }
+    }
+
+    void close_connection (Connection *conn)
+    {
+        std::erase_if (batch_, [conn](const Pending_Request &pending)
+        {
+            return pending.conn == conn;
+        });
+
+        ::epoll_ctl (epoll_.get(), EPOLL_CTL_DEL, conn->fd.get(), nullptr);
+        connections_.erase (conn->fd.get());
+    }
+
+    // Returns false if an error occurred. The requests received before the peer closed
+    // the connection are still added to the batch
+    bool receive (Connection *conn)
+    {
+        constexpr std::size_t chunk_size = 4096;
+
+        for (;;)
+        {
+            auto old_size = conn->input.size();
+            conn->input.resize (old_size + chunk_size);
+
+            auto n_read = ::read (conn->fd.get(), conn->input.data() + old_size, chunk_size);
+            if (n_read > 0)
+            {
+                conn->input.resize (old_size + n_read);
+                continue;
+            }
+
+            conn->input.resize (old_size);
+
+            if (n_read == 0)
+            {
+                conn->peer_closed = true;
+
+                // The socket stays readable from now on
+                if (conn->waits_for_epollout)
+                    rewatch (conn->fd.get(), EPOLLOUT);
+                break;
+            }
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            return false;
+        }
+
+        auto n_requests = conn->input.size() / sizeof (Request);
+
+        for (std::size_t i = 0; i != n_requests; ++i)
+        {
+            Request request;
+            std::memcpy (&request, conn->input.data() + i * sizeof (Request), sizeof (Request));
+
+            batch_.push_back (Pending_Request{request, conn, conn->output.size()});
+            conn->output.push_back (Response{request.tag, Status::ok, {}, 0});
+        }
+
+        conn->input.erase (conn->input.begin(),
+                           conn->input.begin() + n_requests * sizeof (Request));
+        return true;
+    }
+
+    /*
+     * Requests that arrived within one event loop iteration are reordered, but a request never
+     * observes a later one from the same connection. The batch is split into phases: a new
+     * phase of a connection begins at every insertion that follows a lookup. Phases are served
+     * one after another. In each of them, all insertions are applied first in ascending order
+     * of keys, then lookups are served sorted by key. Sorting makes consecutive descents follow
+     * almost the same path, so most of the nodes they touch are already in cache. Usually
+     * clients do not interleave reads and writes, and a batch is a single phase.
+     */
+    void execute_batch ()
+    {
+        if (batch_.empty())
+            return;
+
+        // Requests of a connection are in the batch in the order they were received
+        struct Phase_State final
+        {
+            std::size_t phase = 0;
+            bool after_lookup = false;
+        };
+
+        std::unordered_map<const Connection *, Phase_State> states;
+        for (auto &pending : batch_)
+        {
+            auto &state = states[pending.conn];
+            auto insert = is_insert (pending);
+
+            if (insert && state.after_lookup)
+                state.phase++;
+            state.after_lookup = !insert;
+            pending.phase = state.phase;
+        }
+
+        std::stable_sort (batch_.begin(), batch_.end(),
+                          [](const Pending_Request &lhs, const Pending_Request &rhs)
+        {
+            return lhs.phase < rhs.phase;
+        });
+
+        for (auto first = batch_.begin(); first != batch_.end();)
+        {
+            auto last = std::find_if (first, batch_.end(),
+                                      [phase = first->phase](const Pending_Request &pending)
+            {
+                return pending.phase != phase;
+            });
+
+            execute_phase (first, last);
+            first = last;
+        }
+
+        n_requests_ += batch_.size();
+        n_batches_++;
+
+        batch_.clear();
+    }
+
+    using batch_iterator = std::vector<Pending_Request>::iterator;
+
+    static bool is_insert (const Pending_Request &pending)
+    {
+        return pending.request.opcode == Opcode::insert;
+    }
+
+    void execute_phase (batch_iterator first, batch_iterator last)
+    {
+        auto by_key = [](const Pending_Request &lhs, const Pending_Request &rhs)
+        {
+            return lhs.request.operand < rhs.request.operand;
+        };
+
+        auto lookups = std::stable_partition (first, last, is_insert);
+
+        // Stable sort keeps the earliest of equal insertions first, so it is the one reported
+        // as inserted
+        std::stable_sort (first, lookups, by_key);
+        for (auto it = first; it != lookups; ++it)
+        {
+            auto [node, inserted] = tree_.insert (it->request.operand);
+            it->response().value = inserted;
+        }
+
+        std::sort (lookups, last, [](const Pending_Request &lhs, const Pending_Request &rhs)
+        {
+            if (lhs.request.opcode != rhs.request.opcode)
+                return lhs.request.opcode < rhs.request.opcode;
+            return lhs.request.operand < rhs.request.operand;
+        });
+        for (auto it = lookups; it != last; ++it)
+            serve_lookup (it->request, it->response());
+    }
+
+    void serve_lookup (const Request &request, Response &response) const
+    {
+        auto key = request.operand;
+
+        switch (request.opcode)
+        {
+            case Opcode::find:
+            {
+                auto it = tree_.find (key);
+                if (it == tree_.end())
+                    response.status = Status::not_found;
+                else
+                    response.value = *it;
+                break;
+            }
+
+            case Opcode::lower_bound:
+            {
+                auto it = tree_.lower_bound (key);
+                if (it == tree_.end())
+                    response.status = Status::not_found;
+                else
+                    response.value = *it;
+                break;
+            }
+
+            case Opcode::rank:
+                response.value = static_cast<key_type>(tree_.count_less (key));
+                break;
+
+            case Opcode::kth:
+            {
+                auto it = (key < 0) ? tree_.end() : tree_.kth_smallest (static_cast<std::size_t>(key));
+                if (it == tree_.end())
+                    response.status = Status::not_found;
+                else
+                    response.value = *it;
+                break;
+            }
+
+            default:
+                response.status = Status::bad_request;
+                break;
+        }
+    }
+
+    // Returns false if an error occurred
+    bool send (Connection *conn)
+    {
+        auto data = reinterpret_cast<const char *>(conn->output.data());
+        auto n_bytes = conn->output.size() * sizeof (Response);
+
+        while (conn->n_sent_bytes != n_bytes)
+        {
+            auto n_written = ::send (conn->fd.get(), data + conn->n_sent_bytes,
+                                     n_bytes - conn->n_sent_bytes, MSG_NOSIGNAL);
+            if (n_written >= 0)
+            {
+                conn->n_sent_bytes += n_written;
+                continue;
+            }
+
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                if (!conn->waits_for_epollout)
+                {
+                    rewatch (conn->fd.get(), conn->peer_closed ? EPOLLOUT : EPOLLIN | EPOLLOUT);
+                    conn->waits_for_epollout = true;
+                }
+                return true;
+            }
+            return false;
+        }
+
+        conn->output.clear();
+        conn->n_sent_bytes = 0;
+
+        if (conn->waits_for_epollout)
+        {
+            rewatch (conn->fd.get(), EPOLLIN);
+            conn->waits_for_epollout = false;
+        }
+
+        return true;
+    }
+};
+
+} // unnamed namespace
+
+int main (int argc, char **argv)
+{
+    std::string path = (argc > 1) ? argv[1] : default_socket_path;
+
+    struct sigaction action{};
+    action.sa_handler = on_signal;
+    ::sigaction (SIGINT, &action, nullptr);
+    ::sigaction (SIGTERM, &action, nullptr);
+
+    try
+    {
+        Server server{path};
+        std::cout << "Listening on " << path << std::endl;
+
+        server.run();
+        server.print_statistics (std::cout);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "tree_server: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
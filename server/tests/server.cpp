@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "protocol.hpp"
+
+namespace
+{
+
+using namespace yLab::protocol;
+
+// Runs tree_server on its own socket for the lifetime of the object
+class Server_Process final
+{
+    std::string path_ = "/tmp/yLab_tree_test_" + std::to_string (::getpid()) + ".sock";
+    pid_t pid_ = -1;
+
+public:
+
+    Server_Process ()
+    {
+        pid_ = ::fork();
+        if (pid_ == 0)
+        {
+            ::execl (TREE_SERVER_PATH, TREE_SERVER_PATH, path_.c_str(), static_cast<char *>(nullptr));
+            ::_exit (127);
+        }
+    }
+
+    Server_Process (const Server_Process &rhs) = delete;
+    Server_Process &operator= (const Server_Process &rhs) = delete;
+
+    ~Server_Process ()
+    {
+        if (pid_ > 0)
+        {
+            ::kill (pid_, SIGTERM);
+            ::waitpid (pid_, nullptr, 0);
+        }
+    }
+
+    // Returns -1 if the server has not started listening in a few seconds
+    int connect () const
+    {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        std::strcpy (addr.sun_path, path_.c_str());
+
+        for (auto attempt = 0; attempt != 500; ++attempt)
+        {
+            auto fd = ::socket (AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (::connect (fd, reinterpret_cast<sockaddr *>(&addr), sizeof (addr)) == 0)
+                return fd;
+
+            ::close (fd);
+            std::this_thread::sleep_for (std::chrono::milliseconds{10});
+        }
+
+        return -1;
+    }
+};
+
+Request make_request (std::uint32_t tag, Opcode opcode, key_type operand)
+{
+    Request request{};
+    request.tag = tag;
+    request.opcode = opcode;
+    request.operand = operand;
+
+    return request;
+}
+
+bool read_all (int fd, void *data, std::size_t n_bytes)
+{
+    auto bytes = static_cast<char *>(data);
+    while (n_bytes)
+    {
+        auto n_read = ::read (fd, bytes, n_bytes);
+        if (n_read == 0 || (n_read == -1 && errno != EINTR))
+            return false;
+        if (n_read == -1)
+            continue;
+
+        bytes += n_read;
+        n_bytes -= n_read;
+    }
+
+    return true;
+}
+
+} // unnamed namespace
+
+TEST (Server, Pipelined_Requests_Keep_Order)
+{
+    Server_Process server;
+    auto fd = server.connect();
+    ASSERT_NE (fd, -1);
+
+    // Sent in one write, so the server serves them as one batch
+    std::array requests{make_request (0, Opcode::find, 5),
+                        make_request (1, Opcode::insert, 5),
+                        make_request (2, Opcode::find, 5),
+                        make_request (3, Opcode::rank, 6),
+                        make_request (4, Opcode::insert, 3),
+                        make_request (5, Opcode::insert, 3),
+                        make_request (6, Opcode::rank, 6),
+                        make_request (7, Opcode::kth, 0)};
+
+    ASSERT_EQ (::send (fd, requests.data(), sizeof (requests), MSG_NOSIGNAL),
+               static_cast<ssize_t>(sizeof (requests)));
+
+    std::array<Response, requests.size()> responses;
+    ASSERT_TRUE (read_all (fd, responses.data(), sizeof (responses)));
+    ::close (fd);
+
+    for (std::uint32_t i = 0; i != responses.size(); ++i)
+        EXPECT_EQ (responses[i].tag, i);
+
+    EXPECT_EQ (responses[0].status, Status::not_found);
+    EXPECT_EQ (responses[1].value, 1);
+    EXPECT_EQ (responses[2].status, Status::ok);
+    EXPECT_EQ (responses[2].value, 5);
+    EXPECT_EQ (responses[3].value, 1);
+    EXPECT_EQ (responses[4].value, 1);
+    EXPECT_EQ (responses[5].value, 0);
+    EXPECT_EQ (responses[6].value, 2);
+    EXPECT_EQ (responses[7].value, 3);
+}
+
+TEST (Server, Responds_After_Half_Close)
+{
+    Server_Process server;
+    auto fd = server.connect();
+    ASSERT_NE (fd, -1);
+
+    std::array requests{make_request (0, Opcode::insert, 10),
+                        make_request (1, Opcode::insert, 20),
+                        make_request (2, Opcode::lower_bound, 15),
+                        make_request (3, Opcode::rank, 20)};
+
+    // The client sends no more requests, as socat and nc -N do
+    ASSERT_EQ (::send (fd, requests.data(), sizeof (requests), MSG_NOSIGNAL),
+               static_cast<ssize_t>(sizeof (requests)));
+    ASSERT_EQ (::shutdown (fd, SHUT_WR), 0);
+
+    std::array<Response, requests.size()> responses;
+    ASSERT_TRUE (read_all (fd, responses.data(), sizeof (responses)));
+
+    EXPECT_EQ (responses[0].value, 1);
+    EXPECT_EQ (responses[1].value, 1);
+    EXPECT_EQ (responses[2].value, 20);
+    EXPECT_EQ (responses[3].value, 1);
+
+    // Then the server closes the connection
+    char byte;
+    EXPECT_EQ (::read (fd, &byte, 1), 0);
+    ::close (fd);
+}
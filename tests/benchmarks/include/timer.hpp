@@ -0,0 +1,35 @@
+#ifndef INCLUDE_TIMER_HPP
+#define INCLUDE_TIMER_HPP
+
+#include <chrono>
+#include <utility>
+
+namespace yLab
+{
+
+namespace bench
+{
+
+// Returns the time it takes to call func in seconds
+template <typename F>
+double measure (F &&func)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::forward<F>(func)();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+// Prevents the compiler from optimizing away the computation of value
+template <typename T>
+void do_not_optimize (const T &value)
+{
+    asm volatile ("" : : "r,m" (value) : "memory");
+}
+
+} // namespace bench
+
+} // namespace yLab
+
+#endif // INCLUDE_TIMER_HPP
@@ -0,0 +1,103 @@
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "adaptive_tree.hpp"
+#include "rb_tree.hpp"
+#include "timer.hpp"
+
+// Lookups of random keys in RB_Tree and in Adaptive_Tree, in a read-only phase and in short and
+// long phases of insertions followed by lookups
+int main ()
+{
+    using key_type = std::uint64_t;
+
+    constexpr std::size_t n_keys = 1'000'000;
+    constexpr std::size_t n_lookups = 2'000'000;
+    constexpr std::size_t n_phase_writes = 1'000;
+    constexpr std::size_t max_phases = 20;
+
+    std::mt19937_64 gen{42};
+
+    std::vector<key_type> keys (n_keys);
+    for (auto &key : keys)
+        key = gen() / 2;
+
+    std::vector<key_type> lookups (n_lookups);
+    for (std::size_t i = 0; i != n_lookups; ++i)
+        lookups[i] = (i % 2) ? keys[gen() % n_keys] : gen() / 2;
+
+    std::vector<key_type> phase_writes (2 * max_phases * n_phase_writes);
+    for (auto &key : phase_writes)
+        key = gen() / 2;
+
+    yLab::RB_Tree<key_type> tree;
+    yLab::Adaptive_Tree<key_type> adaptive;
+    for (auto key : keys)
+    {
+        tree.insert (key);
+        adaptive.insert (key);
+    }
+
+    std::size_t n_found = 0;
+
+    auto tree_ns = yLab::bench::measure ([&]
+    {
+        for (auto key : lookups)
+            n_found += tree.contains (key);
+    }) / n_lookups * 1e9;
+
+    // The first lookups of the phase make the copy
+    auto adaptive_ns = yLab::bench::measure ([&]
+    {
+        for (auto key : lookups)
+            n_found += adaptive.contains (key);
+    }) / n_lookups * 1e9;
+
+    auto frozen_ns = yLab::bench::measure ([&]
+    {
+        for (auto key : lookups)
+            n_found += adaptive.contains (key);
+    }) / n_lookups * 1e9;
+
+    std::size_t next_write = 0;
+    auto phases = [&](auto &container, std::size_t n_phases, std::size_t n_phase_lookups)
+    {
+        return yLab::bench::measure ([&]
+        {
+            for (std::size_t phase = 0; phase != n_phases; ++phase)
+            {
+                for (std::size_t i = 0; i != n_phase_writes; ++i)
+                    container.insert (phase_writes[next_write++ % phase_writes.size()]);
+
+                for (std::size_t i = 0; i != n_phase_lookups; ++i)
+                    n_found += container.contains (lookups[(phase * 7919 + i) % n_lookups]);
+            }
+        }) / (n_phases * (n_phase_writes + n_phase_lookups)) * 1e9;
+    };
+
+    auto tree_short_ns = phases (tree, max_phases, 100'000);
+    auto tree_long_ns = phases (tree, 4, 2'500'000);
+
+    next_write = 0;
+    auto adaptive_short_ns = phases (adaptive, max_phases, 100'000);
+    auto adaptive_long_ns = phases (adaptive, 4, 2'500'000);
+
+    yLab::bench::do_not_optimize (n_found);
+
+    std::cout << std::fixed << std::setprecision (1)
+              << "Read-only phase, " << n_keys << " keys\n"
+              << "RB_Tree                        " << std::setw (8) << tree_ns << " ns per lookup\n"
+              << "Adaptive_Tree, freezing        " << std::setw (8) << adaptive_ns << " ns per lookup\n"
+              << "Adaptive_Tree, frozen          " << std::setw (8) << frozen_ns << " ns per lookup\n"
+              << max_phases << " phases of " << n_phase_writes << " insertions and 100000 lookups\n"
+              << "RB_Tree                        " << std::setw (8) << tree_short_ns << " ns per operation\n"
+              << "Adaptive_Tree                  " << std::setw (8) << adaptive_short_ns << " ns per operation\n"
+              << "4 phases of " << n_phase_writes << " insertions and 2500000 lookups\n"
+              << "RB_Tree                        " << std::setw (8) << tree_long_ns << " ns per operation\n"
+              << "Adaptive_Tree                  " << std::setw (8) << adaptive_long_ns << " ns per operation\n"
+              << "Freezes: " << adaptive.n_freezes() << ", thaws: " << adaptive.n_thaws() << "\n";
+}
@@ -0,0 +1,83 @@
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "cached_tree.hpp"
+#include "timer.hpp"
+
+// Compares repeated find/count_less/kth_smallest queries on RB_Tree and Cached_Tree with and
+// without the cache for different frequencies of updates
+int main ()
+{
+    using key_type = std::uint64_t;
+
+    constexpr std::size_t n_keys = 1'000'000;
+    constexpr std::size_t n_queries = 3'000'000;
+    constexpr std::size_t n_hot = 512;
+
+    std::mt19937_64 gen{42};
+
+    std::vector<key_type> keys (n_keys);
+    for (auto &key : keys)
+        key = gen() % (n_keys * 4);
+
+    // 90% of queries come from a small hot set
+    std::vector<key_type> hot (n_hot);
+    for (auto &key : hot)
+        key = gen() % (n_keys * 4);
+
+    std::vector<key_type> queries (n_queries);
+    for (auto &query : queries)
+        query = (gen() % 10) ? hot[gen() % n_hot] : gen() % (n_keys * 4);
+
+    std::cout << std::setw (16) << "update period" << std::setw (14) << "RB_Tree"
+              << std::setw (18) << "cache disabled" << std::setw (16) << "cache enabled"
+              << std::setw (12) << "hit rate" << "  (ns per query)\n";
+
+    for (std::size_t update_period : {0, 1000, 100, 10})
+    {
+        auto run = [&](auto &tree)
+        {
+            key_type new_key = n_keys * 4;
+
+            return yLab::bench::measure ([&]
+            {
+                std::size_t sum = 0;
+                for (std::size_t i = 0; i != n_queries; ++i)
+                {
+                    if (update_period && i % update_period == 0)
+                        tree.insert (new_key++);
+
+                    auto query = queries[i];
+                    switch (i % 3)
+                    {
+                        case 0: sum += tree.contains (query); break;
+                        case 1: sum += tree.count_less (query); break;
+                        case 2: sum += *tree.kth_smallest (query % n_keys); break;
+                    }
+                }
+                yLab::bench::do_not_optimize (sum);
+            }) / n_queries * 1e9;
+        };
+
+        yLab::RB_Tree<key_type> plain;
+        yLab::Cached_Tree<key_type> disabled{0}, enabled;
+        plain.insert (keys.begin(), keys.end());
+        disabled.insert (keys.begin(), keys.end());
+        enabled.insert (keys.begin(), keys.end());
+
+        auto plain_ns = run (plain);
+        auto disabled_ns = run (disabled);
+        auto enabled_ns = run (enabled);
+
+        std::cout << std::setw (16) << (update_period ? std::to_string (update_period) : "never")
+                  << std::fixed << std::setprecision (1)
+                  << std::setw (14) << plain_ns << std::setw (18) << disabled_ns
+                  << std::setw (16) << enabled_ns
+                  << std::setw (11) << enabled.stats().hit_rate() * 100 << "%\n";
+    }
+}
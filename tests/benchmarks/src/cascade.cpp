@@ -0,0 +1,54 @@
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "fractional_cascade.hpp"
+#include "timer.hpp"
+
+// Compares count_less() of the same key in every tree of a family with fractional cascading
+int main ()
+{
+    using key_type = std::uint64_t;
+    constexpr std::size_t n_keys_per_tree = 100'000;
+    constexpr std::size_t n_queries = 100'000;
+
+    std::mt19937_64 gen{42};
+
+    std::vector<key_type> queries (n_queries);
+    for (auto &query : queries)
+        query = gen();
+
+    for (std::size_t n_trees : {4, 16, 64})
+    {
+        std::vector<yLab::RB_Tree<key_type>> trees (n_trees);
+        for (auto &tree : trees)
+            for (std::size_t i = 0; i != n_keys_per_tree; ++i)
+                tree.insert (gen());
+
+        yLab::Fractional_Cascade<key_type> cascade{trees};
+        std::vector<std::size_t> ranks (n_trees);
+
+        auto per_tree = yLab::bench::measure ([&]
+        {
+            for (auto query : queries)
+                for (std::size_t t = 0; t != n_trees; ++t)
+                    ranks[t] = trees[t].count_less (query);
+            yLab::bench::do_not_optimize (ranks);
+        });
+
+        auto cascaded = yLab::bench::measure ([&]
+        {
+            for (auto query : queries)
+                cascade.count_less (query, ranks);
+            yLab::bench::do_not_optimize (ranks);
+        });
+
+        std::cout << std::setw (3) << n_trees << " trees: "
+                  << std::fixed << std::setprecision (0)
+                  << std::setw (8) << per_tree / n_queries * 1e9 << " ns per query tree by tree, "
+                  << std::setw (8) << cascaded / n_queries * 1e9 << " ns per query with cascading\n";
+    }
+}
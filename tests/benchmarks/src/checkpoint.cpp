@@ -0,0 +1,57 @@
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <unistd.h>
+
+#include "rb_tree.hpp"
+#include "serialization.hpp"
+#include "checkpoint.hpp"
+#include "timer.hpp"
+
+// Compares the time a writer is blocked by a synchronous snapshot and by a fork() checkpoint,
+// and counts pages copied while the writer keeps inserting during the checkpoint
+int main (int argc, char **argv)
+{
+    using key_type = std::uint64_t;
+
+    std::size_t n_keys = (argc > 1) ? std::stoul (argv[1]) : 4'000'000;
+    std::size_t n_concurrent_inserts = (argc > 2) ? std::stoul (argv[2]) : 200'000;
+    std::string path = "/tmp/yLab_checkpoint_" + std::to_string (::getpid());
+
+    std::mt19937_64 gen{42};
+    yLab::RB_Tree<key_type> tree;
+    for (std::size_t i = 0; i != n_keys; ++i)
+        tree.insert (gen());
+
+    auto blocking = yLab::bench::measure ([&]
+    {
+        std::ofstream file{path, std::ios::binary};
+        yLab::serialization::serialize (file, tree);
+    });
+
+    std::cout << "keys:                  " << tree.size() << "\n"
+              << "synchronous snapshot:  " << blocking << " s blocked\n";
+
+    yLab::Checkpoint checkpoint{tree, path};
+
+    std::size_t n_inserted = 0;
+    auto inserting = yLab::bench::measure ([&]
+    {
+        for (; n_inserted != n_concurrent_inserts && !checkpoint.done(); ++n_inserted)
+            tree.insert (gen());
+    });
+
+    auto report = checkpoint.wait();
+
+    std::cout << "fork checkpoint:       " << report.fork_time.count() << " s blocked, "
+              << report.elapsed.count() << " s until written"
+              << (report.succeeded ? "" : " (FAILED)") << "\n"
+              << "inserts meanwhile:     " << n_inserted << " in " << inserting << " s\n"
+              << "pages copied:          " << report.pages_copied << " ("
+              << report.pages_copied * 4096.0 / (1 << 20) << " MiB)" << std::endl;
+
+    ::unlink (path.c_str());
+}
@@ -0,0 +1,135 @@
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "lock_free_tree.hpp"
+#include "skip_list.hpp"
+#include "timer.hpp"
+
+namespace
+{
+
+using key_type = std::uint64_t;
+
+constexpr std::size_t n_initial_keys = 1'000'000;
+constexpr key_type key_range = 1 << 22;
+constexpr std::size_t n_operations = 2'000'000; // split among threads
+
+// RB_Tree behind a reader-writer lock
+class Locked_Tree final
+{
+    yLab::RB_Tree<key_type> tree_;
+    mutable std::shared_mutex mutex_;
+
+public:
+
+    void insert (key_type key)
+    {
+        std::unique_lock lock{mutex_};
+        tree_.insert (key);
+    }
+
+    void erase (key_type key)
+    {
+        // RB_Tree cannot erase keys, so erasures are replaced with exclusive lookups
+        std::unique_lock lock{mutex_};
+        yLab::bench::do_not_optimize (tree_.contains (key));
+    }
+
+    bool contains (key_type key) const
+    {
+        std::shared_lock lock{mutex_};
+        return tree_.contains (key);
+    }
+};
+
+class Lock_Free final
+{
+    yLab::Lock_Free_Tree<key_type> tree_;
+
+public:
+
+    void insert (key_type key) { tree_.insert (key); }
+    void erase (key_type key) { tree_.erase (key); }
+    bool contains (key_type key) const { return tree_.contains (key); }
+};
+
+class Skip_List final
+{
+    yLab::Concurrent_Skip_List<key_type> list_;
+
+public:
+
+    void insert (key_type key) { list_.insert (key); }
+    void erase (key_type key) { list_.erase (key); }
+    bool contains (key_type key) const { return list_.contains (key); }
+};
+
+// Returns millions of operations per second. update_percent of operations are evenly split
+// between insertions and erasures, the rest are lookups
+template <typename Set_T>
+double run (std::size_t n_threads, unsigned update_percent)
+{
+    Set_T set;
+
+    std::mt19937_64 gen{42};
+    for (std::size_t i = 0; i != n_initial_keys; ++i)
+        set.insert (gen() % key_range);
+
+    auto seconds = yLab::bench::measure ([&]
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&set, t, n_threads, update_percent]
+            {
+                std::mt19937_64 gen{t + 1};
+                std::size_t n_found = 0;
+
+                for (auto i = n_operations / n_threads; i; --i)
+                {
+                    auto key = gen() % key_range;
+                    auto op = gen() % 200;
+
+                    if (op < update_percent)
+                        set.insert (key);
+                    else if (op < 2 * update_percent)
+                        set.erase (key);
+                    else
+                        n_found += set.contains (key);
+                }
+
+                yLab::bench::do_not_optimize (n_found);
+            });
+    });
+
+    return n_operations / seconds / 1e6;
+}
+
+} // unnamed namespace
+
+// Throughput of mixed workloads on 1M keys with the number of threads growing up to 64
+int main ()
+{
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << '\n';
+
+    for (unsigned update_percent : {10, 50})
+    {
+        std::cout << "\n" << update_percent << "% updates\n"
+                  << std::setw (8) << "threads" << std::setw (18) << "RB_Tree + rwlock"
+                  << std::setw (18) << "Lock_Free_Tree" << std::setw (22) << "Concurrent_Skip_List"
+                  << "   (Mops/s)\n";
+
+        for (std::size_t n_threads : {1, 2, 4, 8, 16, 32, 64})
+            std::cout << std::setw (8) << n_threads << std::fixed << std::setprecision (2)
+                      << std::setw (18) << run<Locked_Tree>(n_threads, update_percent)
+                      << std::setw (18) << run<Lock_Free>(n_threads, update_percent)
+                      << std::setw (22) << run<Skip_List>(n_threads, update_percent) << '\n';
+    }
+}
@@ -0,0 +1,52 @@
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "timer.hpp"
+
+// Compares dumping a tree to a vector by iteration and by to_vector() with different numbers
+// of threads
+int main ()
+{
+    using key_type = std::uint64_t;
+
+    constexpr std::size_t n_keys = 4'000'000;
+    constexpr int n_repeats = 5;
+
+    std::mt19937_64 gen{42};
+
+    yLab::RB_Tree<key_type> tree;
+    for (std::size_t i = 0; i != n_keys; ++i)
+        tree.insert (gen());
+
+    auto iterated = yLab::bench::measure ([&]
+    {
+        for (auto r = 0; r != n_repeats; ++r)
+        {
+            std::vector<key_type> keys;
+            keys.reserve (tree.size());
+            for (auto key : tree)
+                keys.push_back (key);
+            yLab::bench::do_not_optimize (keys.data());
+        }
+    }) / n_repeats * 1e3;
+
+    std::cout << std::fixed << std::setprecision (1)
+              << "iteration:            " << std::setw (8) << iterated << " ms\n";
+
+    for (std::size_t n_threads = 1; n_threads <= 2 * std::thread::hardware_concurrency(); n_threads *= 2)
+    {
+        auto exported = yLab::bench::measure ([&]
+        {
+            for (auto r = 0; r != n_repeats; ++r)
+                yLab::bench::do_not_optimize (tree.to_vector (n_threads).data());
+        }) / n_repeats * 1e3;
+
+        std::cout << "to_vector, " << std::setw (2) << n_threads << " threads: "
+                  << std::setw (8) << exported << " ms\n";
+    }
+}
@@ -0,0 +1,150 @@
+#include <array>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "combining_tree.hpp"
+#include "timer.hpp"
+
+namespace
+{
+
+using key_type = std::uint64_t;
+
+constexpr std::size_t n_initial_keys = 1'000'000;
+constexpr key_type key_range = 1 << 22;
+constexpr std::size_t n_operations = 1'000'000; // split among threads
+
+// RB_Tree behind one mutex
+class Locked_Tree final
+{
+    yLab::RB_Tree<key_type> tree_;
+    std::mutex mutex_;
+
+public:
+
+    bool insert (key_type key)
+    {
+        std::lock_guard lock{mutex_};
+        return tree_.insert (key).second;
+    }
+
+    bool erase (key_type key)
+    {
+        std::lock_guard lock{mutex_};
+        return tree_.erase (key);
+    }
+
+    bool contains (key_type key)
+    {
+        std::lock_guard lock{mutex_};
+        return tree_.contains (key);
+    }
+};
+
+// Key range split into n_shards RB_Trees with a mutex each
+class Sharded_Tree final
+{
+    static constexpr std::size_t n_shards = 16;
+
+    struct alignas (64) Shard final
+    {
+        yLab::RB_Tree<key_type> tree;
+        std::mutex mutex;
+    };
+
+    std::array<Shard, n_shards> shards_;
+
+    Shard &shard (key_type key) { return shards_[key * n_shards / key_range]; }
+
+public:
+
+    bool insert (key_type key)
+    {
+        auto &shard = this->shard (key);
+        std::lock_guard lock{shard.mutex};
+        return shard.tree.insert (key).second;
+    }
+
+    bool erase (key_type key)
+    {
+        auto &shard = this->shard (key);
+        std::lock_guard lock{shard.mutex};
+        return shard.tree.erase (key);
+    }
+
+    bool contains (key_type key)
+    {
+        auto &shard = this->shard (key);
+        std::lock_guard lock{shard.mutex};
+        return shard.tree.contains (key);
+    }
+};
+
+// Returns millions of operations per second. update_percent of operations are evenly split
+// between insertions and erasures, the rest are lookups
+template <typename Set_T>
+double run (std::size_t n_threads, unsigned update_percent)
+{
+    Set_T set;
+
+    std::mt19937_64 gen{42};
+    for (std::size_t i = 0; i != n_initial_keys; ++i)
+        set.insert (gen() % key_range);
+
+    auto seconds = yLab::bench::measure ([&]
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&set, t, n_threads, update_percent]
+            {
+                std::mt19937_64 gen{t + 1};
+                std::size_t n_succeeded = 0;
+
+                for (auto i = n_operations / n_threads; i; --i)
+                {
+                    auto key = gen() % key_range;
+                    auto op = gen() % 200;
+
+                    if (op < update_percent)
+                        n_succeeded += set.insert (key);
+                    else if (op < 2 * update_percent)
+                        n_succeeded += set.erase (key);
+                    else
+                        n_succeeded += set.contains (key);
+                }
+
+                yLab::bench::do_not_optimize (n_succeeded);
+            });
+    });
+
+    return n_operations / seconds / 1e6;
+}
+
+} // unnamed namespace
+
+// Throughput of write-heavy workloads on 1M keys with the number of threads growing up to 64
+int main ()
+{
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << '\n';
+
+    for (unsigned update_percent : {100, 50})
+    {
+        std::cout << "\n" << update_percent << "% updates\n"
+                  << std::setw (8) << "threads" << std::setw (16) << "RB_Tree + mutex"
+                  << std::setw (16) << "16 shards" << std::setw (18) << "Combining_Tree"
+                  << "   (Mops/s)\n";
+
+        for (std::size_t n_threads : {1, 4, 8, 16, 32, 64})
+            std::cout << std::setw (8) << n_threads << std::fixed << std::setprecision (2)
+                      << std::setw (16) << run<Locked_Tree>(n_threads, update_percent)
+                      << std::setw (16) << run<Sharded_Tree>(n_threads, update_percent)
+                      << std::setw (18) << run<yLab::Combining_Tree<key_type>>(n_threads, update_percent)
+                      << '\n';
+    }
+}
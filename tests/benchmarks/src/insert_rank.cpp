@@ -0,0 +1,50 @@
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "timer.hpp"
+
+// Counts inversions of a random stream by inserting each key and taking the number of smaller
+// keys that have arrived before it: with insert() and count_less() and with insert_with_rank()
+int main ()
+{
+    using key_type = std::uint64_t;
+
+    constexpr std::size_t n_keys = 1'000'000;
+
+    std::mt19937_64 gen{42};
+
+    std::vector<key_type> stream (n_keys);
+    for (auto &key : stream)
+        key = gen();
+
+    std::size_t separate_inversions = 0, fused_inversions = 0;
+
+    auto separate_ns = yLab::bench::measure ([&]
+    {
+        yLab::RB_Tree<key_type> tree;
+        for (std::size_t i = 0; i != n_keys; ++i)
+        {
+            tree.insert (stream[i]);
+            separate_inversions += i - tree.count_less (stream[i]);
+        }
+    }) / n_keys * 1e9;
+
+    auto fused_ns = yLab::bench::measure ([&]
+    {
+        yLab::RB_Tree<key_type> tree;
+        for (std::size_t i = 0; i != n_keys; ++i)
+            fused_inversions += i - std::get<1>(tree.insert_with_rank (stream[i]));
+    }) / n_keys * 1e9;
+
+    std::cout << std::fixed << std::setprecision (1)
+              << "Inversions: " << fused_inversions
+              << ((fused_inversions == separate_inversions) ? "" : " (MISMATCH)") << "\n"
+              << "insert + count_less   " << std::setw (8) << separate_ns << " ns per key\n"
+              << "insert_with_rank      " << std::setw (8) << fused_ns << " ns per key\n";
+}
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "timer.hpp"
+
+// Measures both strategies of merge_from() for a tree of n keys and a sorted batch of m keys.
+// The costs per key it prints are the constants of the cost model in rb_tree.hpp
+int main ()
+{
+    using key_type = std::uint64_t;
+    using yLab::Merge_Strategy;
+
+    std::mt19937_64 gen{42};
+    auto random_keys = [&](std::size_t n)
+    {
+        std::vector<key_type> keys (n);
+        for (auto &key : keys)
+            key = gen();
+        std::sort (keys.begin(), keys.end());
+
+        return keys;
+    };
+
+    std::cout << std::setw (9) << "n" << std::setw (9) << "m"
+              << std::setw (14) << "insert, ns/m" << std::setw (16) << "rebuild, ns/n+m"
+              << std::setw (10) << "auto" << std::setw (10) << "best" << '\n';
+
+    for (std::size_t n : {10'000, 100'000, 1'000'000})
+    {
+        auto base = random_keys (n);
+
+        for (std::size_t m = n / 1000 + 1; m <= 4 * n; m *= 4)
+        {
+            auto batch = random_keys (m);
+
+            double seconds[2];
+            Merge_Strategy strategies[2] = {Merge_Strategy::insert, Merge_Strategy::rebuild};
+
+            for (auto i = 0; i != 2; ++i)
+            {
+                yLab::RB_Tree<key_type> tree;
+                tree.merge_from (base);
+
+                seconds[i] = yLab::bench::measure ([&]{ tree.merge_from (batch, strategies[i]); });
+                yLab::bench::do_not_optimize (tree.size());
+            }
+
+            yLab::RB_Tree<key_type> tree;
+            tree.merge_from (base);
+            auto automatic = yLab::bench::measure ([&]{ tree.merge_from (batch); });
+
+            std::cout << std::setw (9) << n << std::setw (9) << m << std::fixed << std::setprecision (1)
+                      << std::setw (14) << seconds[0] * 1e9 / m
+                      << std::setw (16) << seconds[1] * 1e9 / (n + m)
+                      << std::setw (10) << std::setprecision (0) << automatic * 1e9 / m
+                      << std::setw (10) << std::min (seconds[0], seconds[1]) * 1e9 / m << '\n';
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "node_arena.hpp"
+#include "packed_set.hpp"
+#include "timer.hpp"
+
+// Compares memory, lookup, rank and scan of RB_Tree and Packed_Set over dense sorted ids
+int main ()
+{
+    using key_type = std::uint64_t;
+    using arena_type = yLab::Node_Arena<yLab::RB_Node<key_type>>;
+
+    constexpr std::size_t n_keys = 4'000'000;
+    constexpr std::size_t n_queries = 1'000'000;
+
+    std::mt19937_64 gen{42};
+
+    for (key_type max_gap : {2, 16, 256})
+    {
+        std::uniform_int_distribution<key_type> gap{1, max_gap};
+
+        std::vector<key_type> keys (n_keys);
+        key_type key = 0;
+        for (auto &k : keys)
+            k = key += gap (gen);
+
+        yLab::RB_Tree<key_type> tree;
+        for (auto k : keys)
+            tree.insert (k);
+
+        yLab::Packed_Set<key_type> packed (keys.begin(), keys.end());
+
+        std::vector<key_type> queries (n_queries);
+        for (auto &query : queries)
+            query = gen() % (key + 1);
+
+        auto tree_bytes = static_cast<double>(arena_type::page_size) / arena_type::nodes_per_page;
+        auto packed_bytes = static_cast<double>(packed.size_in_bytes()) / packed.size();
+
+        auto lookup = [&](auto &set)
+        {
+            return yLab::bench::measure ([&]
+            {
+                std::size_t n_found = 0;
+                for (auto query : queries)
+                    n_found += set.contains (query);
+                yLab::bench::do_not_optimize (n_found);
+            }) / n_queries * 1e9;
+        };
+
+        auto rank = [&](auto &set)
+        {
+            return yLab::bench::measure ([&]
+            {
+                std::size_t sum = 0;
+                for (auto query : queries)
+                    sum += set.count_less (query);
+                yLab::bench::do_not_optimize (sum);
+            }) / n_queries * 1e9;
+        };
+
+        auto tree_scan = yLab::bench::measure ([&]
+        {
+            key_type sum = 0;
+            for (auto k : tree)
+                sum += k;
+            yLab::bench::do_not_optimize (sum);
+        }) / n_keys * 1e9;
+
+        auto packed_scan = yLab::bench::measure ([&]
+        {
+            key_type sum = 0;
+            packed.for_each ([&sum](key_type k) { sum += k; });
+            yLab::bench::do_not_optimize (sum);
+        }) / n_keys * 1e9;
+
+        std::cout << "Gaps in [1, " << max_gap << "]\n" << std::fixed << std::setprecision (2)
+                  << "    RB_Tree:    " << std::setw (6) << tree_bytes << " bytes per key, "
+                  << std::setw (7) << lookup (tree) << " ns per contains, "
+                  << std::setw (7) << rank (tree) << " ns per count_less, "
+                  << std::setw (5) << tree_scan << " ns per key of scan\n"
+                  << "    Packed_Set: " << std::setw (6) << packed_bytes << " bytes per key, "
+                  << std::setw (7) << lookup (packed) << " ns per contains, "
+                  << std::setw (7) << rank (packed) << " ns per count_less, "
+                  << std::setw (5) << packed_scan << " ns per key of scan\n";
+    }
+}
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "kll_sketch.hpp"
+#include "timer.hpp"
+
+// Compares the exact order-statistic tree with KLL sketches of different k: insertion throughput,
+// memory and the largest rank error over 1000 evenly spaced quantiles
+int main ()
+{
+    using key_type = std::uint64_t;
+    constexpr std::size_t n_keys = 4'000'000;
+    constexpr std::size_t n_probes = 1000;
+
+    std::mt19937_64 gen{42};
+    std::vector<key_type> keys (n_keys);
+    for (auto &key : keys)
+        key = gen();
+
+    auto sorted = keys;
+    std::sort (sorted.begin(), sorted.end());
+
+    std::vector<key_type> probes (n_probes);
+    for (std::size_t i = 0; i != n_probes; ++i)
+        probes[i] = sorted[i * n_keys / n_probes];
+
+    auto report = [](const std::string &name, double seconds, std::size_t n_retained,
+                     double max_error)
+    {
+        std::cout << std::left << std::setw (16) << name << std::right
+                  << std::setw (12) << std::fixed << std::setprecision (0) << n_keys / seconds << " inserts/s"
+                  << std::setw (10) << n_retained << " keys kept"
+                  << std::setw (12) << std::setprecision (5) << max_error << " max rank error\n";
+    };
+
+    {
+        yLab::RB_Tree<key_type> tree;
+        auto seconds = yLab::bench::measure ([&]
+        {
+            for (auto key : keys)
+                tree.insert (key);
+        });
+
+        double max_error = 0.0;
+        for (std::size_t i = 0; i != n_probes; ++i)
+        {
+            double error = std::abs (static_cast<double>(tree.count_less (probes[i])) -
+                                     static_cast<double>(i * n_keys / n_probes));
+            max_error = std::max (max_error, error / n_keys);
+        }
+
+        report ("RB_Tree", seconds, tree.size(), max_error);
+    }
+
+    for (std::size_t k : {50, 200, 800, 3200})
+    {
+        yLab::KLL_Sketch<key_type> sketch{k};
+        auto seconds = yLab::bench::measure ([&]
+        {
+            for (auto key : keys)
+                sketch.insert (key);
+        });
+
+        double max_error = 0.0;
+        for (std::size_t i = 0; i != n_probes; ++i)
+        {
+            double error = std::abs (static_cast<double>(sketch.count_less (probes[i])) -
+                                     static_cast<double>(i * n_keys / n_probes));
+            max_error = std::max (max_error, error / n_keys);
+        }
+
+        report ("KLL, k = " + std::to_string (k), seconds, sketch.n_retained(), max_error);
+    }
+}
@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "rb_map.hpp"
+#include "timer.hpp"
+
+// Compares range additions and range sums of RB_Map with walking over the range in std::map
+int main ()
+{
+    using key_type = std::uint32_t;
+    using value_type = std::int64_t;
+
+    constexpr std::size_t n_keys = 1'000'000;
+    constexpr std::size_t n_ops = 20'000;
+
+    std::mt19937 gen{42};
+
+    yLab::RB_Map<key_type, value_type> map;
+    std::map<key_type, value_type> std_map;
+    for (key_type key = 0; key != n_keys; ++key)
+    {
+        map.insert (key, key % 100);
+        std_map.emplace (key, key % 100);
+    }
+
+    std::cout << std::setw (12) << "range size" << std::setw (20) << "RB_Map add + sum"
+              << std::setw (22) << "std::map add + sum" << "  (ns per pair of operations)\n";
+
+    for (std::size_t range : {10, 1'000, 100'000})
+    {
+        std::vector<key_type> firsts (n_ops);
+        for (auto &first : firsts)
+            first = gen() % (n_keys - range);
+
+        auto lazy = yLab::bench::measure ([&]
+        {
+            value_type total = 0;
+            for (auto first : firsts)
+            {
+                map.add (first, first + range - 1, 1);
+                total += map.sum (first, first + range - 1);
+            }
+            yLab::bench::do_not_optimize (total);
+        }) / n_ops * 1e9;
+
+        auto walk = yLab::bench::measure ([&]
+        {
+            value_type total = 0;
+            for (auto first : firsts)
+            {
+                auto from = std_map.lower_bound (first), to = std_map.upper_bound (first + range - 1);
+                for (auto it = from; it != to; ++it)
+                    it->second += 1;
+                for (auto it = from; it != to; ++it)
+                    total += it->second;
+            }
+            yLab::bench::do_not_optimize (total);
+        }) / n_ops * 1e9;
+
+        std::cout << std::setw (12) << range << std::fixed << std::setprecision (0)
+                  << std::setw (20) << lazy << std::setw (22) << walk << "\n";
+    }
+}
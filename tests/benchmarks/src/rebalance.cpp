@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "timer.hpp"
+
+// Measures the average depth of a key and the lookup time in trees built by random and ascending
+// insertions before and after rebalance_perfect(), and the time the rebalancing takes
+int main ()
+{
+    using key_type = std::uint64_t;
+
+    constexpr std::size_t n_keys = 1'000'000;
+    constexpr std::size_t n_lookups = 1'000'000;
+
+    std::mt19937_64 gen{42};
+
+    std::vector<key_type> keys (n_keys), queries (n_lookups);
+    for (auto &key : keys)
+        key = gen();
+    for (auto &query : queries)
+        query = keys[gen() % n_keys];
+
+    auto run = [&](const char *name, const std::vector<key_type> &insertion_order)
+    {
+        yLab::RB_Tree<key_type> tree;
+        tree.insert (insertion_order.begin(), insertion_order.end());
+
+        auto average_depth = [&]
+        {
+            std::size_t total = 0;
+            for (auto it = tree.cbegin(), ite = tree.cend(); it != ite; ++it)
+                for (auto node = it.base(); node != ite.base(); node = node->parent_)
+                    total++;
+
+            return static_cast<double>(total) / tree.size();
+        };
+
+        auto lookups = [&]
+        {
+            return yLab::bench::measure ([&]
+            {
+                std::size_t n_found = 0;
+                for (auto query : queries)
+                    n_found += (std::as_const (tree).find (query) != tree.cend());
+                yLab::bench::do_not_optimize (n_found);
+            }) / n_lookups * 1e9;
+        };
+
+        auto depth_before = average_depth();
+        auto lookup_before = lookups();
+
+        auto rebalance_ns = yLab::bench::measure ([&] { tree.rebalance_perfect(); }) / n_keys * 1e9;
+
+        std::cout << std::left << std::setw (20) << name << std::right
+                  << std::setw (8) << depth_before << std::setw (10) << lookup_before
+                  << std::setw (10) << average_depth() << std::setw (10) << lookups()
+                  << std::setw (14) << rebalance_ns << "\n";
+    };
+
+    auto ascending = keys;
+    std::sort (ascending.begin(), ascending.end());
+
+    std::cout << std::fixed << std::setprecision (2)
+              << "Keys: " << n_keys << "\n"
+              << "                      before             after       rebalance\n"
+              << "                       depth   ns/find     depth   ns/find   ns per key\n";
+
+    run ("random insertions", keys);
+    run ("ascending insertions", ascending);
+}
@@ -0,0 +1,160 @@
+#include <malloc.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "sg_tree.hpp"
+#include "timer.hpp"
+
+namespace
+{
+
+// Heap usage counted by the replaced operator new and operator delete below, so that the
+// benchmark reports all memory a tree holds: arena pages, the end node and any buffers
+std::size_t live_bytes = 0;
+std::size_t peak_bytes = 0;
+
+void *allocate (std::size_t size, std::size_t alignment)
+{
+    size = std::max (size, std::size_t{1});
+
+    auto ptr = (alignment <= alignof (std::max_align_t))
+             ? std::malloc (size)
+             : std::aligned_alloc (alignment, (size + alignment - 1) / alignment * alignment);
+    if (ptr == nullptr)
+        throw std::bad_alloc{};
+
+    live_bytes += malloc_usable_size (ptr);
+    peak_bytes = std::max (peak_bytes, live_bytes);
+
+    return ptr;
+}
+
+void deallocate (void *ptr) noexcept
+{
+    if (ptr)
+    {
+        live_bytes -= malloc_usable_size (ptr);
+        std::free (ptr);
+    }
+}
+
+// Average number of nodes visited by a successful lookup
+template <typename Tree_T>
+double average_depth (const Tree_T &tree)
+{
+    std::size_t total = 0;
+    for (auto it = tree.begin(), ite = tree.end(); it != ite; ++it)
+        for (auto node = it.base(); node != ite.base(); node = node->parent_)
+            total++;
+
+    return static_cast<double>(total) / tree.size();
+}
+
+} // unnamed namespace
+
+void *operator new (std::size_t size) { return allocate (size, alignof (std::max_align_t)); }
+void *operator new (std::size_t size, std::align_val_t alignment)
+{
+    return allocate (size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete (void *ptr) noexcept { deallocate (ptr); }
+void operator delete (void *ptr, std::size_t) noexcept { deallocate (ptr); }
+void operator delete (void *ptr, std::align_val_t) noexcept { deallocate (ptr); }
+void operator delete (void *ptr, std::size_t, std::align_val_t) noexcept { deallocate (ptr); }
+
+// Compares memory, insertion and lookup time of SG_Tree with different alpha and RB_Tree
+// on read-mostly data: the tree is built once and then queried. Memory is the heap the tree
+// holds after the insertions and the peak during them. The insertion time of the copy is the
+// time of copying per key
+int main ()
+{
+    using key_type = std::uint64_t;
+
+    constexpr std::size_t n_keys = 1'000'000;
+    constexpr std::size_t n_lookups = 1'000'000;
+
+    std::mt19937_64 gen{42};
+
+    std::vector<key_type> keys (n_keys), queries (n_lookups);
+    for (auto &key : keys)
+        key = gen();
+    for (auto &query : queries)
+        query = keys[gen() % n_keys];
+
+    auto lookups = [&](const auto &tree)
+    {
+        return yLab::bench::measure ([&]
+        {
+            std::size_t n_found = 0;
+            for (auto query : queries)
+                n_found += (tree.lower_bound (query) != tree.end());
+            yLab::bench::do_not_optimize (n_found);
+        }) / n_lookups * 1e9;
+    };
+
+    auto report = [&](const std::string &name, const auto &tree, double bytes, double peak,
+                      double insert_ns)
+    {
+        std::cout << std::left << std::setw (18) << name << std::right
+                  << std::setw (8) << bytes
+                  << std::setw (11) << peak
+                  << std::setw (12) << average_depth (tree)
+                  << std::setw (12) << insert_ns
+                  << std::setw (16) << lookups (tree) << "\n";
+    };
+
+    auto run = [&](const std::string &name, auto tree, const std::vector<key_type> &keys)
+    {
+        auto empty_bytes = peak_bytes = live_bytes;
+
+        auto insert_ns = yLab::bench::measure ([&]
+        {
+            tree.insert (keys.begin(), keys.end());
+            yLab::bench::do_not_optimize (tree.size());
+        }) / n_keys * 1e9;
+
+        report (name, tree, static_cast<double>(live_bytes - empty_bytes) / n_keys,
+                static_cast<double>(peak_bytes - empty_bytes) / n_keys, insert_ns);
+        return tree;
+    };
+
+    std::cout << std::fixed << std::setprecision (2)
+              << "Keys: " << n_keys << " x " << sizeof (key_type) << " bytes\n"
+              << "                  bytes/key  peak/key  avg depth  ns/insert  ns/lower_bound\n";
+
+    run ("RB_Tree", yLab::RB_Tree<key_type>{}, keys);
+    for (auto alpha : {0.55, 0.6, 0.8})
+        run ("SG_Tree a=" + std::to_string (alpha).substr (0, 4), yLab::SG_Tree<key_type>{alpha}, keys);
+
+    // Ascending keys make scapegoats high in the tree, up to the root
+    auto sorted = keys;
+    std::sort (sorted.begin(), sorted.end());
+    run ("  sorted keys", yLab::SG_Tree<key_type>{0.7}, sorted);
+
+    // A copy is perfectly balanced, which suits data that is loaded once and then only read
+    auto tree = run ("SG_Tree a=0.70", yLab::SG_Tree<key_type>{0.7}, keys);
+
+    std::size_t copy_bytes = 0;
+    auto before_copy = peak_bytes = live_bytes;
+    auto copy_ns = yLab::bench::measure ([&]
+    {
+        auto copy = tree;
+        copy_bytes = live_bytes - before_copy;
+        yLab::bench::do_not_optimize (copy.size());
+        tree = std::move (copy);
+    }) / n_keys * 1e9;
+
+    report ("  copy of it", tree, static_cast<double>(copy_bytes) / n_keys,
+            static_cast<double>(peak_bytes - before_copy) / n_keys, copy_ns);
+}
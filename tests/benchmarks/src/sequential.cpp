@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "timer.hpp"
+
+// Compares lookups with a cursor, which reuse the last accessed node in sequential runs, with
+// plain lookups, which always descend from the root, and insertions with and without explicit hints
+int main ()
+{
+    using key_type = std::uint64_t;
+
+    constexpr std::size_t n_keys = 1'000'000;
+
+    std::mt19937_64 gen{42};
+
+    std::vector<key_type> sorted (n_keys);
+    for (std::size_t i = 0; i != n_keys; ++i)
+        sorted[i] = 4 * i;
+
+    auto shuffled = sorted;
+    std::shuffle (shuffled.begin(), shuffled.end(), gen);
+
+    yLab::RB_Tree<key_type> tree;
+    for (auto key : shuffled)
+        tree.insert (key);
+
+    std::vector<key_type> ascending (n_keys), random (n_keys);
+    for (std::size_t i = 0; i != n_keys; ++i)
+    {
+        ascending[i] = sorted[i] + 1;
+        random[i] = shuffled[i] + 1;
+    }
+
+    auto lookups = [&](const std::vector<key_type> &queries, bool with_cursor)
+    {
+        return yLab::bench::measure ([&]
+        {
+            yLab::RB_Tree<key_type>::Cursor cursor;
+            key_type sum = 0;
+            for (auto query : queries)
+                sum += with_cursor ? *tree.lower_bound (cursor, query - 1)
+                                   : *tree.lower_bound (query - 1);
+            yLab::bench::do_not_optimize (sum);
+        }) / n_keys * 1e9;
+    };
+
+    auto inserts = [&](const std::vector<key_type> &keys, bool hinted)
+    {
+        yLab::RB_Tree<key_type> tree;
+        return yLab::bench::measure ([&]
+        {
+            auto hint = tree.cend();
+            for (auto key : keys)
+                if (hinted)
+                    hint = tree.insert (hint, key);
+                else
+                    tree.insert (key);
+            yLab::bench::do_not_optimize (tree.size());
+        }) / n_keys * 1e9;
+    };
+
+    std::cout << std::fixed << std::setprecision (1)
+              << "lower_bound, ns per query     from root    with cursor\n"
+              << "    ascending keys       " << std::setw (12) << lookups (ascending, false)
+              << std::setw (15) << lookups (ascending, true) << "\n"
+              << "    random keys          " << std::setw (12) << lookups (random, false)
+              << std::setw (15) << lookups (random, true) << "\n"
+              << "insert, ns per key           with hints    with finger\n"
+              << "    ascending keys       " << std::setw (12) << inserts (sorted, true)
+              << std::setw (15) << inserts (sorted, false) << "\n"
+              << "    random keys          " << std::setw (12) << inserts (shuffled, true)
+              << std::setw (15) << inserts (shuffled, false) << "\n";
+}
@@ -0,0 +1,68 @@
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "node_arena.hpp"
+#include "succinct_tree.hpp"
+#include "timer.hpp"
+
+// Compares memory and lookup time of RB_Tree and its succinct copy
+int main ()
+{
+    using key_type = std::uint64_t;
+    using arena_type = yLab::Node_Arena<yLab::RB_Node<key_type>>;
+
+    constexpr std::size_t n_keys = 4'000'000;
+    constexpr std::size_t n_lookups = 1'000'000;
+
+    std::mt19937_64 gen{42};
+
+    yLab::RB_Tree<key_type> tree;
+    for (std::size_t i = 0; i != n_keys; ++i)
+        tree.insert (gen());
+
+    yLab::Succinct_Tree<key_type> succinct{tree};
+
+    std::vector<key_type> queries (n_lookups);
+    for (auto &query : queries)
+        query = gen();
+
+    // Nodes are packed into pages of the arena, so a node takes a bit more than its size
+    auto tree_bytes_per_key = static_cast<double>(arena_type::page_size) / arena_type::nodes_per_page;
+    auto succinct_bytes_per_key = static_cast<double>(succinct.size_in_bytes()) / succinct.size();
+
+    auto tree_seconds = yLab::bench::measure ([&]
+    {
+        std::size_t n_found = 0;
+        for (auto query : queries)
+            n_found += (tree.lower_bound (query) != tree.end());
+        yLab::bench::do_not_optimize (n_found);
+    });
+
+    auto succinct_seconds = yLab::bench::measure ([&]
+    {
+        std::size_t n_found = 0;
+        for (auto query : queries)
+            n_found += (succinct.lower_bound (query) != succinct.end());
+        yLab::bench::do_not_optimize (n_found);
+    });
+
+    auto scan_seconds = yLab::bench::measure ([&]
+    {
+        key_type sum = 0;
+        for (auto key : succinct)
+            sum += key;
+        yLab::bench::do_not_optimize (sum);
+    });
+
+    std::cout << std::fixed << std::setprecision (2)
+              << "Keys:            " << n_keys << " x " << sizeof (key_type) << " bytes\n"
+              << "RB_Tree:         " << tree_bytes_per_key << " bytes per key, "
+              << tree_seconds / n_lookups * 1e9 << " ns per lower_bound\n"
+              << "Succinct_Tree:   " << succinct_bytes_per_key << " bytes per key, "
+              << succinct_seconds / n_lookups * 1e9 << " ns per lower_bound, "
+              << scan_seconds / n_keys * 1e9 << " ns per key of in-order scan\n";
+}
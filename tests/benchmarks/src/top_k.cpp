@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "top_k.hpp"
+#include "timer.hpp"
+
+// Compares Top_K with the usual top-k over a binary min-heap on a random stream, where most keys
+// are rejected, and on an ascending one, where every key replaces the minimum
+int main ()
+{
+    using key_type = std::uint64_t;
+
+    constexpr std::size_t n_keys = 1'000'000;
+
+    std::mt19937_64 gen{42};
+
+    std::vector<key_type> ascending (n_keys);
+    std::iota (ascending.begin(), ascending.end(), key_type{0});
+
+    auto random = ascending;
+    std::shuffle (random.begin(), random.end(), gen);
+
+    auto top_k = [&](const std::vector<key_type> &stream, std::size_t k)
+    {
+        return yLab::bench::measure ([&]
+        {
+            yLab::Top_K<key_type> top{k};
+            top.insert (stream.begin(), stream.end());
+            yLab::bench::do_not_optimize (top.min());
+        }) / n_keys * 1e9;
+    };
+
+    auto heap = [&](const std::vector<key_type> &stream, std::size_t k)
+    {
+        return yLab::bench::measure ([&]
+        {
+            std::priority_queue<key_type, std::vector<key_type>, std::greater<>> top;
+            for (auto key : stream)
+            {
+                if (top.size() < k)
+                    top.push (key);
+                else if (top.top() < key)
+                {
+                    top.pop();
+                    top.push (key);
+                }
+            }
+            yLab::bench::do_not_optimize (top.top());
+        }) / n_keys * 1e9;
+    };
+
+    std::cout << std::fixed << std::setprecision (1)
+              << "ns per key                   Top_K       min-heap\n";
+
+    for (std::size_t k : {100, 10'000})
+        std::cout << "    k = " << std::setw (6) << k << ", random   " << std::setw (9) << top_k (random, k)
+                  << std::setw (15) << heap (random, k) << "\n"
+                  << "    k = " << std::setw (6) << k << ", ascending" << std::setw (9) << top_k (ascending, k)
+                  << std::setw (15) << heap (ascending, k) << "\n";
+}
@@ -0,0 +1,53 @@
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "buffered_tree.hpp"
+#include "timer.hpp"
+
+// Compares throughput of random insertions into RB_Tree with and without a write buffer
+int main ()
+{
+    using key_type = std::uint64_t;
+    constexpr std::size_t n_keys = 2'000'000;
+
+    std::mt19937_64 gen{42};
+    std::vector<key_type> keys (n_keys);
+    for (auto &key : keys)
+        key = gen();
+
+    auto report = [](const char *name, double seconds)
+    {
+        std::cout << std::left << std::setw (28) << name << std::right << std::setw (10)
+                  << std::fixed << std::setprecision (3) << seconds << " s "
+                  << std::setw (12) << std::setprecision (0) << n_keys / seconds << " inserts/s\n";
+    };
+
+    {
+        yLab::RB_Tree<key_type> tree;
+        report ("direct insert", yLab::bench::measure ([&]
+        {
+            for (auto key : keys)
+                tree.insert (key);
+        }));
+        yLab::bench::do_not_optimize (tree.size());
+    }
+
+    for (std::size_t threshold : {64, 256, 1024, 4096, 16384, 65536})
+    {
+        yLab::Buffered_Tree<key_type> tree{threshold};
+        auto seconds = yLab::bench::measure ([&]
+        {
+            for (auto key : keys)
+                tree.insert (key);
+            tree.merge();
+        });
+
+        std::string name = "buffered, threshold " + std::to_string (threshold);
+        report (name.c_str(), seconds);
+        yLab::bench::do_not_optimize (tree.size());
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef INCLUDE_INVARIANTS_HPP
+#define INCLUDE_INVARIANTS_HPP
+
+#include <gtest/gtest.h>
+#include <cstddef>
+
+#include "rb_tree.hpp"
+
+namespace yLab
+{
+
+namespace test
+{
+
+namespace details
+{
+
+// Returns black height of the subtree or a failure describing the first violated property
+template <typename Key_T>
+::testing::AssertionResult check_subtree (const RB_Node<Key_T> *node, std::size_t &black_height)
+{
+    black_height = 1;
+    if (node == nullptr)
+        return ::testing::AssertionSuccess();
+
+    for (auto child : {node->left_, node->right_})
+    {
+        if (child == nullptr)
+            continue;
+
+        if (child->parent_ != node)
+            return ::testing::AssertionFailure() << "wrong parent of " << child->key();
+        if (node->color_ == RB_Color::red && child->color_ == RB_Color::red)
+            return ::testing::AssertionFailure() << "red node " << child->key() << " has red parent";
+    }
+
+    if (node->left_ && !(node->left_->key() < node->key()))
+        return ::testing::AssertionFailure() << "left child of " << node->key() << " is not less";
+    if (node->right_ && !(node->key() < node->right_->key()))
+        return ::testing::AssertionFailure() << "right child of " << node->key() << " is not greater";
+
+    std::size_t left_height = 0, right_height = 0;
+    if (auto result = check_subtree (node->left_, left_height); !result)
+        return result;
+    if (auto result = check_subtree (node->right_, right_height); !result)
+        return result;
+
+    if (left_height != right_height)
+        return ::testing::AssertionFailure() << "different black heights below " << node->key();
+
+    auto size = yLab::details::size (node->left_) + yLab::details::size (node->right_) + 1;
+    if (node->size_ != size)
+        return ::testing::AssertionFailure() << "wrong subtree size of " << node->key();
+
+    black_height = left_height + (node->color_ == RB_Color::black);
+    return ::testing::AssertionSuccess();
+}
+
+} // namespace details
+
+template <typename Key_T>
+::testing::AssertionResult is_valid_rb_tree (const RB_Tree<Key_T> &tree)
+{
+    auto end_node = tree.end().base();
+    auto root = end_node->left_;
+
+    if (root == nullptr)
+    {
+        if (tree.size() != 0 || tree.begin() != tree.end())
+            return ::testing::AssertionFailure() << "empty tree is not empty";
+        return ::testing::AssertionSuccess();
+    }
+
+    if (root->parent_ != end_node)
+        return ::testing::AssertionFailure() << "root is not linked to the end node";
+    if (root->color_ != RB_Color::black)
+        return ::testing::AssertionFailure() << "root is red";
+    if (root->size_ != tree.size())
+        return ::testing::AssertionFailure() << "size of the tree differs from size of the root";
+    if (tree.begin().base() != yLab::details::minimum (root))
+        return ::testing::AssertionFailure() << "begin() is not the leftmost node";
+
+    std::size_t black_height = 0;
+    return details::check_subtree (root, black_height);
+}
+
+} // namespace test
+
+} // namespace yLab
+
+#endif // INCLUDE_INVARIANTS_HPP
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <set>
+
+#include "adaptive_tree.hpp"
+
+using Representation = yLab::Adaptive_Tree<int>::Representation;
+
+// Reads until the tree is frozen and returns the number of reads
+static std::size_t freeze (yLab::Adaptive_Tree<int> &tree)
+{
+    std::size_t n_reads = 0;
+    for (; !tree.frozen() && n_reads < 1'000'000; ++n_reads)
+        tree.contains (0);
+
+    return n_reads;
+}
+
+TEST (Adaptive_Tree, Freezes_After_Reads)
+{
+    yLab::Adaptive_Tree<int> tree{8, 4};
+    for (auto key = 0; key != 5; ++key)
+        tree.insert (2 * key);
+
+    for (auto i = 0; i != 7; ++i)
+        EXPECT_TRUE (tree.contains (2 * i % 10));
+    EXPECT_EQ (tree.representation(), Representation::tree);
+
+    // The 8th read starts the copy; 5 keys take 2 reads by 4 keys
+    EXPECT_TRUE (tree.contains (4));
+    EXPECT_EQ (tree.representation(), Representation::freezing);
+
+    EXPECT_FALSE (tree.contains (5));
+    EXPECT_TRUE (tree.frozen());
+    EXPECT_EQ (tree.n_freezes(), 1);
+}
+
+// A phase of reads has to be as long as the tree before the copy is started
+TEST (Adaptive_Tree, Freezes_After_Size_Reads)
+{
+    yLab::Adaptive_Tree<int> tree{2, 4};
+    for (auto key = 0; key != 20; ++key)
+        tree.insert (key);
+
+    EXPECT_EQ (freeze (tree), 24);
+}
+
+TEST (Adaptive_Tree, Thaws_On_Change)
+{
+    yLab::Adaptive_Tree<int> tree{1, 100};
+    for (auto key : {1, 3, 5})
+        tree.insert (key);
+
+    EXPECT_EQ (freeze (tree), 3);
+    EXPECT_FALSE (tree.contains (2));
+
+    // Writes that do not change the keys keep the copy
+    EXPECT_FALSE (tree.insert (3));
+    EXPECT_EQ (tree.erase (4), 0);
+    EXPECT_TRUE (tree.frozen());
+    EXPECT_TRUE (tree.contains (3));
+
+    EXPECT_TRUE (tree.insert (2));
+    EXPECT_EQ (tree.representation(), Representation::tree);
+    EXPECT_EQ (tree.n_thaws(), 1);
+
+    freeze (tree);
+    EXPECT_TRUE (tree.contains (2));
+    EXPECT_EQ (tree.n_freezes(), 2);
+
+    EXPECT_EQ (tree.erase (2), 1);
+    EXPECT_FALSE (tree.contains (2));
+    EXPECT_EQ (tree.n_thaws(), 2);
+}
+
+TEST (Adaptive_Tree, Write_Cancels_Freezing)
+{
+    yLab::Adaptive_Tree<int> tree{1, 1};
+    for (auto key = 0; key != 10; ++key)
+        tree.insert (key);
+
+    for (auto key = 0; key != 10; ++key)
+        EXPECT_TRUE (tree.contains (key));
+    EXPECT_EQ (tree.representation(), Representation::freezing);
+
+    tree.insert (10);
+    EXPECT_EQ (tree.representation(), Representation::tree);
+    EXPECT_EQ (tree.n_thaws(), 0);
+
+    freeze (tree);
+    for (auto key = 0; key != 11; ++key)
+        EXPECT_TRUE (tree.contains (key));
+    EXPECT_EQ (tree.lower_bound (-5), 0);
+    EXPECT_EQ (tree.lower_bound (10), 10);
+    EXPECT_EQ (tree.lower_bound (11), std::nullopt);
+}
+
+// Every size up to a few full levels of the layout and every key between the stored ones
+TEST (Adaptive_Tree, Frozen_Lookups)
+{
+    for (auto n = 0; n < 40; ++n)
+    {
+        yLab::Adaptive_Tree<int> tree{0, 64};
+        for (auto key = 0; key < n; ++key)
+            tree.insert (3 * key);
+
+        freeze (tree);
+        ASSERT_TRUE (tree.frozen()) << n;
+
+        for (auto key = -1; key < 3 * n + 2; ++key)
+        {
+            std::optional<int> expected;
+            if (n && key <= 3 * (n - 1))
+                expected = (key <= 0) ? 0 : (key + 2) / 3 * 3;
+
+            EXPECT_EQ (tree.lower_bound (key), expected) << n << ' ' << key;
+            EXPECT_EQ (tree.contains (key), key >= 0 && key % 3 == 0 && key < 3 * n) << n << ' ' << key;
+        }
+    }
+}
+
+TEST (Adaptive_Tree, Random_Phases)
+{
+    std::mt19937 gen{7};
+    std::uniform_int_distribution<int> dist{0, 999};
+
+    yLab::Adaptive_Tree<int> tree{64, 8};
+    std::set<int> expected;
+
+    for (auto phase = 0; phase != 20; ++phase)
+    {
+        auto n_writes = (phase % 2) ? 5 : 200;
+        for (auto i = 0; i != n_writes; ++i)
+        {
+            auto key = dist (gen);
+            if (i % 3 == 2)
+                EXPECT_EQ (tree.erase (key), expected.erase (key));
+            else
+                EXPECT_EQ (tree.insert (key), expected.insert (key).second);
+        }
+
+        for (auto i = 0; i != 500; ++i)
+        {
+            auto key = dist (gen);
+            auto it = expected.lower_bound (key);
+
+            EXPECT_EQ (tree.contains (key), expected.contains (key));
+            EXPECT_EQ (tree.lower_bound (key), (it != expected.end()) ? std::optional<int>{*it} : std::nullopt);
+            EXPECT_EQ (tree.count_less (key), static_cast<std::size_t>(std::distance (expected.begin(), it)));
+        }
+
+        EXPECT_TRUE (tree.frozen());
+    }
+
+    EXPECT_EQ (tree.n_freezes(), tree.n_thaws() + 1);
+    EXPECT_EQ (tree.size(), expected.size());
+}
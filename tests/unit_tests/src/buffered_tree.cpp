@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+
+#include "rb_tree.hpp"
+#include "buffered_tree.hpp"
+#include "invariants.hpp"
+
+TEST (Hinted_Insert, Ascending_Keys)
+{
+    yLab::RB_Tree<int> tree;
+
+    auto hint = tree.cend();
+    for (auto key = 0; key != 1000; ++key)
+    {
+        auto it = tree.insert (hint, key);
+        EXPECT_EQ (*it, key);
+        hint = it;
+    }
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (tree.size(), 1000);
+    EXPECT_EQ (*tree.begin(), 0);
+}
+
+TEST (Hinted_Insert, Arbitrary_Hints)
+{
+    std::mt19937 gen{1};
+    std::uniform_int_distribution<int> dist{0, 5000};
+
+    yLab::RB_Tree<int> tree;
+    std::set<int> model;
+
+    for (auto i = 0; i != 3000; ++i)
+    {
+        auto key = dist (gen);
+        auto hint = tree.kth_smallest (model.empty() ? 0 : gen() % model.size());
+
+        auto it = tree.insert (hint, key);
+        model.insert (key);
+
+        ASSERT_EQ (*it, key);
+    }
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_TRUE (std::equal (tree.begin(), tree.end(), model.begin(), model.end()));
+}
+
+TEST (Buffered_Tree, Contains_Checks_Buffer)
+{
+    yLab::Buffered_Tree<int> tree{4};
+
+    tree.insert (3);
+    tree.insert (1);
+    EXPECT_EQ (tree.buffered(), 2);
+    EXPECT_TRUE (tree.contains (3));
+    EXPECT_TRUE (tree.contains (1));
+    EXPECT_FALSE (tree.contains (2));
+
+    tree.insert (2);
+    tree.insert (3);
+    EXPECT_EQ (tree.buffered(), 0);
+    EXPECT_TRUE (tree.contains (2));
+    EXPECT_EQ (tree.size(), 3);
+}
+
+TEST (Buffered_Tree, Contains_Checks_Sorted_Runs)
+{
+    yLab::Buffered_Tree<int> tree{1000};
+
+    for (auto key = 0; key != 300; ++key)
+        tree.insert ((key * 7) % 300);
+
+    EXPECT_EQ (tree.buffered(), 300);
+    for (auto key = 0; key != 300; ++key)
+        EXPECT_TRUE (tree.contains (key));
+    EXPECT_FALSE (tree.contains (-1));
+    EXPECT_FALSE (tree.contains (300));
+}
+
+TEST (Buffered_Tree, Queries_Merge_Buffer)
+{
+    yLab::Buffered_Tree<int> tree{100};
+
+    for (auto key : {5, 1, 4, 2, 3})
+        tree.insert (key);
+
+    EXPECT_EQ (tree.buffered(), 5);
+    EXPECT_EQ (*tree.kth_smallest (1), 2);
+    EXPECT_EQ (tree.buffered(), 0);
+
+    tree.insert (0);
+    EXPECT_EQ (tree.count_less (3), 3);
+    EXPECT_EQ (tree.lower_bound (6), tree.end());
+    EXPECT_EQ (*tree.begin(), 0);
+}
+
+TEST (Buffered_Tree, Random_Keys)
+{
+    std::mt19937 gen{5};
+    std::uniform_int_distribution<int> dist{0, 20'000};
+
+    yLab::Buffered_Tree<int> tree{64};
+    std::set<int> model;
+
+    for (auto i = 0; i != 10'000; ++i)
+    {
+        auto key = dist (gen);
+        tree.insert (key);
+        model.insert (key);
+
+        if (i % 1000 == 0)
+        {
+            EXPECT_TRUE (tree.contains (key));
+        }
+    }
+
+    tree.set_merge_threshold (1);
+    EXPECT_EQ (tree.buffered(), 0);
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree.tree()));
+    EXPECT_TRUE (std::equal (tree.begin(), tree.end(), model.begin(), model.end()));
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "cached_tree.hpp"
+
+TEST (RB_Tree, Version)
+{
+    yLab::RB_Tree<int> tree;
+    auto version = tree.version();
+
+    tree.insert (1);
+    EXPECT_NE (tree.version(), version);
+
+    version = tree.version();
+    tree.insert (1);
+    EXPECT_EQ (tree.version(), version);
+
+    tree.begin_batch();
+    tree.insert (2);
+    tree.rollback();
+    EXPECT_GT (tree.version(), version + 1);
+
+    yLab::RB_Tree<int> other{tree};
+    version = tree.version();
+    tree = other;
+    EXPECT_GT (tree.version(), version);
+}
+
+TEST (Cached_Tree, Repeated_Queries_Hit)
+{
+    yLab::Cached_Tree<int> tree{64};
+    tree.insert ({1, 5, 9, 13});
+
+    for (auto i = 0; i != 10; ++i)
+    {
+        EXPECT_EQ (*tree.find (5), 5);
+        EXPECT_EQ (tree.find (6), tree.end());
+        EXPECT_EQ (tree.count_less (10), 3);
+        EXPECT_EQ (*tree.kth_smallest (3), 13);
+    }
+
+    EXPECT_EQ (tree.stats().misses, 4);
+    EXPECT_EQ (tree.stats().hits, 36);
+    EXPECT_DOUBLE_EQ (tree.stats().hit_rate(), 0.9);
+}
+
+TEST (Cached_Tree, Updates_Invalidate)
+{
+    yLab::Cached_Tree<int> tree{64};
+    tree.insert ({1, 5, 9});
+
+    EXPECT_EQ (tree.find (7), tree.end());
+    EXPECT_EQ (tree.count_less (8), 2);
+    EXPECT_EQ (*tree.kth_smallest (2), 9);
+
+    tree.insert (7);
+    EXPECT_EQ (*tree.find (7), 7);
+    EXPECT_EQ (tree.count_less (8), 3);
+
+    // Changes made to the tree directly are seen too
+    tree.tree().begin_batch();
+    tree.tree().insert (0);
+    EXPECT_EQ (tree.count_less (8), 4);
+    tree.tree().rollback();
+    EXPECT_EQ (tree.count_less (8), 3);
+    EXPECT_EQ (*tree.kth_smallest (0), 1);
+}
+
+TEST (Cached_Tree, Matches_Tree)
+{
+    std::mt19937 gen{3};
+    std::uniform_int_distribution<int> dist{0, 2'000};
+
+    yLab::RB_Tree<int> expected;
+    yLab::Cached_Tree<int> tree{16};
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        auto key = dist (gen);
+        switch (gen() % 4)
+        {
+            case 0:
+                expected.insert (key);
+                tree.insert (key);
+                break;
+
+            case 1:
+                ASSERT_EQ (tree.contains (key), expected.contains (key));
+                break;
+
+            case 2:
+                ASSERT_EQ (tree.count_less (key), expected.count_less (key));
+                break;
+
+            case 3:
+                ASSERT_EQ (tree.kth_smallest (key) == tree.end(), expected.kth_smallest (key) == expected.end());
+                if (tree.kth_smallest (key) != tree.end())
+                {
+                    ASSERT_EQ (*tree.kth_smallest (key), *expected.kth_smallest (key));
+                }
+                break;
+        }
+    }
+
+    auto copy = tree;
+    EXPECT_TRUE (std::equal (copy.begin(), copy.end(), expected.begin(), expected.end()));
+    EXPECT_EQ (copy.stats().hits + copy.stats().misses, 0);
+    EXPECT_EQ (copy.find (*expected.begin()), copy.begin());
+}
+
+TEST (Cached_Tree, Disabled)
+{
+    yLab::Cached_Tree<int> tree{0};
+    tree.insert ({1, 2, 3});
+
+    EXPECT_FALSE (tree.cache_enabled());
+    EXPECT_EQ (*tree.find (2), 2);
+    EXPECT_EQ (tree.count_less (3), 2);
+    EXPECT_EQ (tree.stats().hits + tree.stats().misses, 0);
+}
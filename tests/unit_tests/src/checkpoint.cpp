@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
+#include "rb_tree.hpp"
+#include "node_arena.hpp"
+#include "serialization.hpp"
+#include "checkpoint.hpp"
+#include "invariants.hpp"
+
+TEST (Node_Arena, Nodes_Do_Not_Cross_Pages)
+{
+    using node_type = yLab::RB_Node<std::int64_t>;
+    using arena_type = yLab::Node_Arena<node_type>;
+
+    arena_type arena;
+    for (std::size_t i = 0; i != 3 * arena_type::nodes_per_block + 5; ++i)
+    {
+        auto node = arena.construct (static_cast<std::int64_t>(i), yLab::RB_Color::red);
+        auto first = reinterpret_cast<std::uintptr_t>(node);
+        auto last = first + sizeof (node_type) - 1;
+
+        ASSERT_EQ (first / arena_type::page_size, last / arena_type::page_size);
+        ASSERT_EQ (node->key(), static_cast<std::int64_t>(i));
+    }
+
+    EXPECT_EQ (arena.n_blocks(), 4);
+}
+
+TEST (Node_Arena, Destroy_Last)
+{
+    yLab::Node_Arena<yLab::RB_Node<std::string>> arena;
+
+    auto first = arena.construct ("first", yLab::RB_Color::red);
+    auto second = arena.construct ("second", yLab::RB_Color::red);
+
+    arena.destroy_last (second);
+    EXPECT_EQ (arena.size(), 1);
+
+    auto third = arena.construct ("third", yLab::RB_Color::red);
+    EXPECT_EQ (third, second);
+    EXPECT_EQ (first->key(), "first");
+}
+
+TEST (Node_Arena, Destroy_Reuses_Slots)
+{
+    yLab::Node_Arena<yLab::RB_Node<std::string>> arena;
+
+    auto first = arena.construct ("first", yLab::RB_Color::red);
+    auto second = arena.construct ("second", yLab::RB_Color::red);
+    auto third = arena.construct ("third", yLab::RB_Color::red);
+
+    arena.destroy (first);
+    arena.destroy (second);
+    EXPECT_EQ (arena.size(), 1);
+
+    EXPECT_EQ (arena.construct ("fourth", yLab::RB_Color::red), second);
+    EXPECT_EQ (arena.construct ("fifth", yLab::RB_Color::red), first);
+    EXPECT_EQ (arena.size(), 3);
+    EXPECT_EQ (third->key(), "third");
+
+    // The destructor has to skip free slots
+    arena.destroy (third);
+}
+
+TEST (Serialization, Round_Trip)
+{
+    yLab::RB_Tree<std::int64_t> tree;
+    for (std::int64_t key = 0; key != 10'000; ++key)
+        tree.insert (key * 7 % 10'007);
+
+    std::stringstream stream;
+    yLab::serialization::serialize (stream, tree);
+    auto copy = yLab::serialization::deserialize<std::int64_t>(stream);
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (copy));
+    EXPECT_TRUE (std::equal (tree.begin(), tree.end(), copy.begin(), copy.end()));
+}
+
+TEST (Serialization, Rejects_Bad_Data)
+{
+    yLab::RB_Tree<std::int32_t> tree;
+    tree.insert ({1, 2, 3});
+
+    std::stringstream stream;
+    yLab::serialization::serialize (stream, tree);
+    auto data = stream.str();
+
+    std::stringstream wrong_key_size{data};
+    EXPECT_THROW (yLab::serialization::deserialize<std::int64_t>(wrong_key_size), std::runtime_error);
+
+    std::stringstream truncated{data.substr (0, data.size() - 1)};
+    EXPECT_THROW (yLab::serialization::deserialize<std::int32_t>(truncated), std::runtime_error);
+
+    std::stringstream garbage{"definitely not a tree"};
+    EXPECT_THROW (yLab::serialization::deserialize<std::int32_t>(garbage), std::runtime_error);
+}
+
+TEST (Checkpoint, Snapshot_Is_Taken_At_Fork)
+{
+    auto path = ::testing::TempDir() + "checkpoint_" + std::to_string (::getpid());
+
+    yLab::RB_Tree<std::int64_t> tree;
+    for (std::int64_t key = 0; key != 100'000; ++key)
+        tree.insert (key);
+
+    yLab::Checkpoint checkpoint{tree, path};
+
+    // Not a part of the snapshot
+    for (std::int64_t key = 100'000; key != 110'000; ++key)
+        tree.insert (key);
+
+    auto report = checkpoint.wait();
+    ASSERT_TRUE (report.succeeded);
+    EXPECT_TRUE (checkpoint.done());
+    EXPECT_GE (report.elapsed, report.fork_time);
+
+    std::ifstream file{path, std::ios::binary};
+    auto snapshot = yLab::serialization::deserialize<std::int64_t>(file);
+
+    EXPECT_EQ (snapshot.size(), 100'000);
+    EXPECT_EQ (*snapshot.kth_smallest (99'999), 99'999);
+
+    std::remove (path.c_str());
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "combining_tree.hpp"
+#include "invariants.hpp"
+
+TEST (Combining_Tree, Matches_Set)
+{
+    std::mt19937 gen{3};
+    std::uniform_int_distribution<int> key_dist{0, 2000};
+
+    yLab::Combining_Tree<int> tree;
+    std::set<int> model;
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        auto key = key_dist (gen);
+        switch (gen() % 3)
+        {
+            case 0:
+                ASSERT_EQ (tree.insert (key), model.insert (key).second);
+                break;
+            case 1:
+                ASSERT_EQ (tree.erase (key), model.erase (key) == 1);
+                break;
+            default:
+                ASSERT_EQ (tree.contains (key), model.contains (key));
+                break;
+        }
+    }
+
+    EXPECT_EQ (tree.size(), model.size());
+    EXPECT_TRUE (std::equal (tree.tree().begin(), tree.tree().end(), model.begin(), model.end()));
+}
+
+TEST (Combining_Tree, Concurrent_Updates)
+{
+    constexpr int n_threads = 8;
+    constexpr int n_keys = 2'000; // per thread
+
+    yLab::Combining_Tree<int> tree;
+    std::atomic<int> n_failed{0};
+
+    {
+        std::vector<std::jthread> threads;
+        for (auto t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&tree, &n_failed, t]
+            {
+                // Keys of different threads interleave, so batches mix them
+                for (auto i = 0; i != n_keys; ++i)
+                    n_failed += !tree.insert (i * n_threads + t);
+
+                for (auto i = 0; i != n_keys; ++i)
+                    n_failed += !tree.contains (i * n_threads + t);
+
+                for (auto i = 0; i < n_keys; i += 2)
+                    n_failed += !tree.erase (i * n_threads + t);
+
+                for (auto i = 0; i < n_keys; i += 2)
+                    n_failed += tree.erase (i * n_threads + t);
+            });
+    }
+
+    EXPECT_EQ (n_failed, 0);
+    EXPECT_EQ (tree.size(), n_threads * n_keys / 2);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree.tree()));
+    EXPECT_EQ (tree.n_combined(), 3 * n_threads * n_keys);
+    EXPECT_LE (tree.n_batches(), tree.n_combined());
+
+    for (auto key = 0; key != n_threads * n_keys; ++key)
+        ASSERT_EQ (tree.tree().contains (key), key / n_threads % 2 == 1);
+}
+
+TEST (Combining_Tree, Same_Key_From_Many_Threads)
+{
+    constexpr int n_threads = 8;
+
+    yLab::Combining_Tree<int> tree;
+    std::atomic<int> n_inserted{0}, n_erased{0};
+
+    {
+        std::vector<std::jthread> threads;
+        for (auto t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&]
+            {
+                for (auto i = 0; i != 1'000; ++i)
+                {
+                    n_inserted += tree.insert (42);
+                    n_erased += tree.erase (42);
+                }
+            });
+    }
+
+    // Every successful erasure removes a key that a successful insertion has added
+    EXPECT_EQ (n_inserted - n_erased, tree.size());
+}
+
+TEST (Combining_Tree, Statistics_While_Combining)
+{
+    constexpr int n_threads = 4;
+    constexpr int n_keys = 2'000;
+
+    yLab::Combining_Tree<int> tree;
+    std::atomic<bool> stop{false};
+
+    std::jthread reader{[&]
+    {
+        // Statistics grow monotonically even while a combiner updates them
+        for (std::size_t last = 0; !stop.load();)
+        {
+            auto n_combined = tree.n_combined();
+            ASSERT_LE (last, n_combined);
+            last = n_combined;
+        }
+    }};
+
+    {
+        std::vector<std::jthread> threads;
+        for (auto t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&tree, t]
+            {
+                for (auto i = 0; i != n_keys; ++i)
+                    tree.insert (i * n_threads + t);
+            });
+    }
+
+    stop = true;
+    EXPECT_EQ (tree.n_combined(), n_threads * n_keys);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "invariants.hpp"
+
+namespace
+{
+
+::testing::AssertionResult same_keys (const yLab::RB_Tree<int> &tree, const std::set<int> &expected)
+{
+    if (tree.size() != expected.size())
+        return ::testing::AssertionFailure() << "size " << tree.size() << " != " << expected.size();
+    if (!std::equal (tree.begin(), tree.end(), expected.begin(), expected.end()))
+        return ::testing::AssertionFailure() << "keys differ";
+    if (!expected.empty() && *std::prev (tree.end()) != *expected.rbegin())
+        return ::testing::AssertionFailure() << "wrong rightmost node";
+
+    return ::testing::AssertionSuccess();
+}
+
+} // unnamed namespace
+
+TEST (Erase, Single)
+{
+    yLab::RB_Tree<int> tree;
+    tree.insert (1);
+
+    EXPECT_EQ (tree.erase (2), 0);
+    EXPECT_EQ (tree.erase (1), 1);
+    EXPECT_TRUE (tree.empty());
+    EXPECT_EQ (tree.begin(), tree.end());
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+
+    tree.insert (3);
+    EXPECT_EQ (*tree.begin(), 3);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+}
+
+TEST (Erase, Random)
+{
+    std::mt19937 gen{7};
+    std::uniform_int_distribution<int> dist{0, 2'000};
+
+    yLab::RB_Tree<int> tree;
+    std::set<int> expected;
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        auto key = dist (gen);
+        if (gen() % 2)
+        {
+            tree.insert (key);
+            expected.insert (key);
+        }
+        else
+            ASSERT_EQ (tree.erase (key), expected.erase (key));
+
+        if (i % 1'000 == 0)
+        {
+            ASSERT_TRUE (yLab::test::is_valid_rb_tree (tree));
+            ASSERT_TRUE (same_keys (tree, expected));
+        }
+    }
+
+    for (auto it = tree.begin(); it != tree.end();)
+    {
+        expected.erase (*it);
+        it = tree.erase (it);
+        ASSERT_EQ (it, tree.begin());
+    }
+
+    EXPECT_TRUE (tree.empty());
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+}
+
+TEST (Erase, Order_Statistics)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 1'000; ++key)
+        tree.insert (key);
+
+    for (auto key = 0; key != 1'000; key += 2)
+        tree.erase (key);
+
+    for (auto k = 0; k != 500; ++k)
+    {
+        ASSERT_EQ (*tree.kth_smallest (k), 2 * k + 1);
+        ASSERT_EQ (tree.count_less (2 * k + 1), k);
+    }
+}
+
+TEST (Erase, Relaxed_And_Unbalanced)
+{
+    std::mt19937 gen{8};
+    std::set<int> expected;
+
+    yLab::RB_Tree<int> tree;
+    tree.enable_relaxed_balance (64);
+    for (auto i = 0; i != 2'000; ++i)
+    {
+        auto key = static_cast<int>(gen() % 10'000);
+        tree.insert (key);
+        expected.insert (key);
+    }
+
+    auto erase_some = [&]
+    {
+        for (auto i = 0; i != 500; ++i)
+        {
+            auto key = static_cast<int>(gen() % 10'000);
+            ASSERT_EQ (tree.erase (key), expected.erase (key));
+        }
+    };
+
+    erase_some();
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_TRUE (same_keys (tree, expected));
+
+    tree.rebuild_by_frequency ([](int key) { return key % 7; });
+    erase_some();
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_TRUE (same_keys (tree, expected));
+}
+
+TEST (Erase, Slots_Are_Reused_In_Batches)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 100; ++key)
+        tree.insert (key);
+
+    for (auto key = 0; key < 100; key += 3)
+        tree.erase (key);
+
+    std::set<int> expected (tree.begin(), tree.end());
+
+    tree.begin_batch();
+    for (auto key = 100; key != 200; ++key)
+        tree.insert (key);
+    tree.rollback();
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_TRUE (same_keys (tree, expected));
+
+    for (auto key = 0; key < 100; key += 3)
+        tree.insert (key);
+
+    EXPECT_EQ (tree.size(), 100);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+}
+
+TEST (Erase, Rejected_In_Batch)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 100; ++key)
+        tree.insert (key);
+
+    tree.begin_batch();
+    for (auto key = 100; key != 200; ++key)
+        tree.insert (key);
+
+    EXPECT_THROW (tree.erase (150), std::logic_error);
+    EXPECT_THROW (tree.erase (tree.find (50)), std::logic_error);
+    EXPECT_EQ (tree.size(), 200);
+
+    tree.rollback();
+
+    std::set<int> expected;
+    for (auto key = 0; key != 100; ++key)
+        expected.insert (key);
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_TRUE (same_keys (tree, expected));
+}
@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+
+TEST (Export, Empty)
+{
+    yLab::RB_Tree<int> tree;
+
+    EXPECT_TRUE (tree.to_vector().empty());
+    EXPECT_TRUE (tree.to_vector (4).empty());
+}
+
+TEST (Export, Matches_Iteration)
+{
+    std::mt19937 gen{5};
+
+    yLab::RB_Tree<int> tree;
+    for (auto i = 0; i != 200'000; ++i)
+        tree.insert (static_cast<int>(gen() % 1'000'000));
+
+    std::vector<int> expected (tree.begin(), tree.end());
+
+    for (std::size_t n_threads : {1, 2, 3, 8})
+        EXPECT_EQ (tree.to_vector (n_threads), expected);
+
+    // Only the first size() elements are written
+    std::vector<int> out (tree.size() + 2, -1);
+    tree.copy_to (out, 4);
+
+    EXPECT_TRUE (std::equal (expected.begin(), expected.end(), out.begin()));
+    EXPECT_EQ (out[tree.size()], -1);
+    EXPECT_EQ (out[tree.size() + 1], -1);
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "fractional_cascade.hpp"
+
+TEST (Fractional_Cascade, Empty_Family)
+{
+    std::vector<yLab::RB_Tree<int>> trees;
+    yLab::Fractional_Cascade<int> cascade{trees};
+
+    EXPECT_EQ (cascade.n_catalogs(), 0);
+    EXPECT_TRUE (cascade.count_less (42).empty());
+}
+
+TEST (Fractional_Cascade, Small_Catalogs)
+{
+    std::vector<yLab::RB_Tree<int>> trees (3);
+    trees[0].insert ({1, 5, 9});
+    trees[2].insert ({2, 5, 6, 7});
+
+    yLab::Fractional_Cascade<int> cascade{trees};
+    ASSERT_EQ (cascade.n_catalogs(), 3);
+
+    EXPECT_EQ (cascade.count_less (5), (std::vector<std::size_t>{1, 0, 1}));
+    EXPECT_EQ (cascade.count_less (0), (std::vector<std::size_t>{0, 0, 0}));
+    EXPECT_EQ (cascade.count_less (10), (std::vector<std::size_t>{3, 0, 4}));
+
+    auto bounds = cascade.lower_bound (6);
+    EXPECT_EQ (*bounds[0], 9);
+    EXPECT_EQ (bounds[1], cascade.catalog (1).end());
+    EXPECT_EQ (*bounds[2], 6);
+}
+
+TEST (Fractional_Cascade, Matches_Every_Tree)
+{
+    constexpr int n_trees = 24;
+
+    std::mt19937 gen{1};
+    std::uniform_int_distribution<int> key_dist{0, 20'000};
+    std::uniform_int_distribution<int> size_dist{0, 3000};
+
+    std::vector<yLab::RB_Tree<int>> trees (n_trees);
+    for (auto &tree : trees)
+        for (auto n = size_dist (gen); n != 0; --n)
+            tree.insert (key_dist (gen));
+
+    yLab::Fractional_Cascade<int> cascade{trees};
+
+    for (auto i = 0; i != 2000; ++i)
+    {
+        auto key = key_dist (gen) - 10;
+        auto ranks = cascade.count_less (key);
+        auto bounds = cascade.lower_bound (key);
+
+        for (auto t = 0; t != n_trees; ++t)
+        {
+            ASSERT_EQ (ranks[t], trees[t].count_less (key));
+
+            auto expected = trees[t].lower_bound (key);
+            if (expected == trees[t].end())
+                ASSERT_EQ (bounds[t], cascade.catalog (t).end());
+            else
+                ASSERT_EQ (*bounds[t], *expected);
+        }
+    }
+}
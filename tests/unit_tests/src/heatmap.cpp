@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+#include "rb_tree.hpp"
+#include "graphic_dump.hpp"
+
+#ifdef YLAB_COUNT_ACCESSES
+
+namespace
+{
+
+std::size_t count_substrings (const std::string &str, const std::string &substr)
+{
+    std::size_t count = 0;
+    for (auto pos = str.find (substr); pos != std::string::npos; pos = str.find (substr, pos + 1))
+        count++;
+
+    return count;
+}
+
+} // unnamed namespace
+
+TEST (Heatmap, Counts_Descents)
+{
+    yLab::RB_Tree<int> tree;
+    tree.insert ({2, 1, 3});
+
+    auto root = tree.end().base()->left_;
+    auto root_accesses = root->n_accesses_;
+    auto left_accesses = root->left_->n_accesses_;
+
+    tree.find (1);
+    tree.find (1);
+    tree.find (2);
+
+    EXPECT_EQ (root->n_accesses_, root_accesses + 3);
+    EXPECT_EQ (root->left_->n_accesses_, left_accesses + 2);
+}
+
+TEST (Heatmap, Dumps_Only_Hottest_Paths)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 1000; ++key)
+        tree.insert (key);
+
+    for (auto it = tree.begin(); it != tree.end(); ++it)
+        it.base()->n_accesses_ = 0;
+
+    for (auto i = 0; i != 100; ++i)
+        tree.find (0);
+
+    std::ostringstream os;
+    yLab::graphic_dump::heatmap_dump<int> (os, tree.begin(), tree.end(), 1);
+    auto dump = os.str();
+
+    // Only the path from the root to the leftmost node is shown
+    std::size_t depth = 0;
+    for (auto node = tree.begin().base(); node != tree.end().base()->left_; node = node->parent_)
+        depth++;
+
+    EXPECT_EQ (count_substrings (dump, "accesses:"), depth + 1);
+    EXPECT_EQ (count_substrings (dump, "more)"), depth);
+    EXPECT_NE (dump.find ("\\nsize: 1000"), std::string::npos);
+}
+
+#endif // YLAB_COUNT_ACCESSES
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "kll_sketch.hpp"
+
+namespace
+{
+
+// Largest difference between estimated and exact ranks of keys 0, step, 2 * step, ...
+// of a sketch built over a permutation of [0, n)
+std::size_t max_rank_error (const yLab::KLL_Sketch<int> &sketch, int n, int step)
+{
+    std::size_t max_error = 0;
+    for (auto key = 0; key < n; key += step)
+    {
+        auto estimate = static_cast<long>(sketch.count_less (key));
+        max_error = std::max<std::size_t>(max_error, std::labs (estimate - key));
+    }
+
+    return max_error;
+}
+
+std::vector<int> shuffled_keys (int n, unsigned seed)
+{
+    std::vector<int> keys (n);
+    std::iota (keys.begin(), keys.end(), 0);
+    std::shuffle (keys.begin(), keys.end(), std::mt19937{seed});
+
+    return keys;
+}
+
+} // unnamed namespace
+
+TEST (KLL_Sketch, Empty)
+{
+    yLab::KLL_Sketch<int> sketch;
+
+    EXPECT_TRUE (sketch.empty());
+    EXPECT_EQ (sketch.count_less (0), 0);
+    EXPECT_EQ (sketch.kth_smallest (0), std::nullopt);
+    EXPECT_EQ (sketch.quantile (0.0), std::nullopt);
+    EXPECT_EQ (sketch.quantile (0.5), std::nullopt);
+    EXPECT_EQ (sketch.quantile (1.0), std::nullopt);
+
+    sketch.insert (7);
+    EXPECT_EQ (sketch.quantile (0.5), 7);
+}
+
+TEST (KLL_Sketch, Exact_While_Small)
+{
+    yLab::KLL_Sketch<int> sketch{200};
+
+    auto keys = shuffled_keys (100, 1);
+    sketch.insert (keys.begin(), keys.end());
+
+    EXPECT_EQ (sketch.size(), 100);
+    EXPECT_EQ (sketch.n_retained(), 100);
+    for (auto k = 0; k != 100; ++k)
+    {
+        EXPECT_EQ (sketch.count_less (k), k);
+        EXPECT_EQ (sketch.kth_smallest (k), k);
+    }
+    EXPECT_EQ (sketch.quantile (0.0), 0);
+    EXPECT_EQ (sketch.quantile (0.5), 50);
+    EXPECT_EQ (sketch.quantile (1.0), 99);
+}
+
+TEST (KLL_Sketch, Error_And_Memory_Are_Bounded)
+{
+    constexpr int n = 200'000;
+    yLab::KLL_Sketch<int> sketch{200};
+
+    auto keys = shuffled_keys (n, 2);
+    sketch.insert (keys.begin(), keys.end());
+
+    EXPECT_EQ (sketch.size(), n);
+    EXPECT_LT (sketch.n_retained(), 4 * sketch.k());
+
+    auto bound = 2 * sketch.normalized_rank_error() * n;
+    EXPECT_LE (max_rank_error (sketch, n, 997), bound);
+
+    for (auto q : {0.01, 0.25, 0.5, 0.75, 0.99})
+        EXPECT_LE (std::abs (*sketch.quantile (q) - q * n), bound);
+}
+
+TEST (KLL_Sketch, Merge)
+{
+    constexpr int n = 200'000;
+    constexpr int n_shards = 4;
+
+    auto keys = shuffled_keys (n, 3);
+
+    std::vector<yLab::KLL_Sketch<int>> shards;
+    for (auto i = 0; i != n_shards; ++i)
+    {
+        shards.emplace_back (200, i + 1);
+
+        auto first = keys.begin() + i * (n / n_shards);
+        shards.back().insert (first, first + n / n_shards);
+    }
+
+    yLab::KLL_Sketch<int> merged{200};
+    for (auto &shard : shards)
+        merged.merge (shard);
+
+    EXPECT_EQ (merged.size(), n);
+    EXPECT_LT (merged.n_retained(), 4 * merged.k());
+    EXPECT_LE (max_rank_error (merged, n, 997), 2 * merged.normalized_rank_error() * n);
+}
+
+TEST (KLL_Sketch, Self_Merge)
+{
+    constexpr int n = 50'000;
+
+    auto keys = shuffled_keys (n, 4);
+
+    yLab::KLL_Sketch<int> sketch{200};
+    sketch.insert (keys.begin(), keys.end());
+    sketch.merge (sketch);
+
+    EXPECT_EQ (sketch.size(), 2 * n);
+    EXPECT_LT (sketch.n_retained(), 4 * sketch.k());
+
+    for (auto key = 0; key < n; key += 997)
+    {
+        auto estimate = static_cast<long>(sketch.count_less (key));
+        EXPECT_LE (std::labs (estimate - 2 * key), 2 * sketch.normalized_rank_error() * 2 * n);
+    }
+}
+
+TEST (KLL_Sketch, Larger_K_Is_More_Accurate)
+{
+    constexpr int n = 200'000;
+    auto keys = shuffled_keys (n, 4);
+
+    yLab::KLL_Sketch<int> coarse{32}, fine{512};
+    coarse.insert (keys.begin(), keys.end());
+    fine.insert (keys.begin(), keys.end());
+
+    EXPECT_LT (coarse.n_retained(), fine.n_retained());
+    EXPECT_LT (max_rank_error (fine, n, 997), max_rank_error (coarse, n, 997));
+}
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <bit>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lock_free_tree.hpp"
+
+TEST (Lock_Free_Tree, Matches_Set)
+{
+    std::mt19937 gen{1};
+    std::uniform_int_distribution<int> key_dist{0, 2000};
+    std::uniform_int_distribution<int> op_dist{0, 2};
+
+    yLab::Lock_Free_Tree<int> tree;
+    std::set<int> model;
+
+    EXPECT_TRUE (tree.empty());
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        auto key = key_dist (gen);
+        switch (op_dist (gen))
+        {
+            case 0:
+                ASSERT_EQ (tree.insert (key).second, model.insert (key).second);
+                break;
+            case 1:
+                ASSERT_EQ (tree.erase (key), model.erase (key));
+                break;
+            default:
+                ASSERT_EQ (tree.contains (key), model.contains (key));
+                break;
+        }
+    }
+
+    EXPECT_EQ (tree.size(), model.size());
+    EXPECT_TRUE (std::equal (tree.begin(), tree.end(), model.begin(), model.end()));
+
+    for (auto key = -1; key != 2002; ++key)
+    {
+        auto lower = model.lower_bound (key);
+        auto upper = model.upper_bound (key);
+
+        if (lower == model.end())
+            ASSERT_EQ (tree.lower_bound (key), tree.end());
+        else
+            ASSERT_EQ (*tree.lower_bound (key), *lower);
+
+        if (upper == model.end())
+            ASSERT_EQ (tree.upper_bound (key), tree.end());
+        else
+            ASSERT_EQ (*tree.upper_bound (key), *upper);
+
+        ASSERT_EQ (tree.find (key) != tree.end(), model.contains (key));
+    }
+}
+
+TEST (Lock_Free_Tree, Non_Trivial_Keys)
+{
+    yLab::Lock_Free_Tree<std::string> tree;
+
+    for (auto i = 0; i != 1000; ++i)
+        tree.insert (std::to_string (i));
+    for (auto i = 0; i != 1000; i += 2)
+        EXPECT_EQ (tree.erase (std::to_string (i)), 1);
+
+    EXPECT_EQ (tree.size(), 500);
+    EXPECT_TRUE (tree.contains ("999"));
+    EXPECT_FALSE (tree.contains ("998"));
+}
+
+TEST (Lock_Free_Tree, Sorted_Keys_Stay_Balanced)
+{
+    constexpr int n_keys = 100'000;
+
+    yLab::Lock_Free_Tree<int> tree;
+
+    for (auto key = 0; key != n_keys; ++key)
+        tree.insert (key);
+    EXPECT_LE (tree.height(), 2 * std::bit_width<unsigned> (n_keys + 1));
+
+    for (auto key = 0; key != n_keys; ++key)
+        if (key % 10 != 0)
+        {
+            ASSERT_EQ (tree.erase (key), 1);
+        }
+    EXPECT_LE (tree.height(), 2 * std::bit_width<unsigned> (n_keys / 10 + 1));
+
+    std::vector<int> expected;
+    for (auto key = 0; key < n_keys; key += 10)
+        expected.push_back (key);
+
+    EXPECT_EQ (tree.size(), expected.size());
+    EXPECT_TRUE (std::equal (tree.begin(), tree.end(), expected.begin(), expected.end()));
+
+    for (auto key : expected)
+        tree.erase (key);
+    EXPECT_TRUE (tree.empty());
+    EXPECT_EQ (tree.height(), 0);
+}
+
+TEST (Lock_Free_Tree, Concurrent_Ascending_Keys)
+{
+    constexpr int n_threads = 8;
+    constexpr int n_keys = 40'000;
+
+    yLab::Lock_Free_Tree<int> tree;
+    {
+        std::vector<std::jthread> threads;
+        for (auto t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&tree, t]
+            {
+                for (auto key = t; key < n_keys; key += n_threads)
+                    tree.insert (key);
+                for (auto key = t; key < n_keys; key += n_threads)
+                    if (key % 4 != 0)
+                        tree.erase (key);
+            });
+    }
+
+    // Every thread repairs the violations it has created before returning
+    EXPECT_LE (tree.height(), 2 * std::bit_width<unsigned> (n_keys / 4 + 1));
+    EXPECT_EQ (tree.size(), n_keys / 4);
+
+    for (auto key = 0; key != n_keys; ++key)
+        ASSERT_EQ (tree.contains (key), key % 4 == 0);
+}
+
+TEST (Lock_Free_Tree, Concurrent_Disjoint_Ranges)
+{
+    constexpr int n_threads = 8;
+    constexpr int n_keys = 20'000;
+
+    yLab::Lock_Free_Tree<int> tree;
+    {
+        std::vector<std::jthread> threads;
+        for (auto t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&tree, t]
+            {
+                std::vector<int> keys;
+                for (auto key = t; key < n_keys; key += n_threads)
+                    keys.push_back (key);
+                std::shuffle (keys.begin(), keys.end(), std::mt19937{static_cast<unsigned>(t)});
+
+                for (auto key : keys)
+                    tree.insert (key);
+                for (auto key : keys)
+                    if (key % 3 == 0)
+                        tree.erase (key);
+            });
+    }
+
+    std::vector<int> expected;
+    for (auto key = 0; key != n_keys; ++key)
+        if (key % 3 != 0)
+            expected.push_back (key);
+
+    EXPECT_EQ (tree.size(), expected.size());
+    EXPECT_TRUE (std::equal (tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
+TEST (Lock_Free_Tree, Concurrent_Contended_Keys)
+{
+    constexpr int n_threads = 8;
+    constexpr int key_range = 64;
+
+    yLab::Lock_Free_Tree<int> tree;
+    std::vector<long> balance (n_threads * key_range);
+    {
+        std::vector<std::jthread> threads;
+        for (auto t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&, t]
+            {
+                std::mt19937 gen{static_cast<unsigned>(t)};
+                for (auto i = 0; i != 50'000; ++i)
+                {
+                    auto key = static_cast<int>(gen() % key_range);
+                    if (gen() % 2)
+                        balance[t * key_range + key] += tree.insert (key).second;
+                    else
+                        balance[t * key_range + key] -= static_cast<long>(tree.erase (key));
+                }
+            });
+    }
+
+    // Every key was inserted one more time than erased if it is in the tree
+    for (auto key = 0; key != key_range; ++key)
+    {
+        long total = 0;
+        for (auto t = 0; t != n_threads; ++t)
+            total += balance[t * key_range + key];
+
+        ASSERT_EQ (total, tree.contains (key) ? 1 : 0);
+    }
+
+    EXPECT_TRUE (std::is_sorted (tree.begin(), tree.end()));
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "invariants.hpp"
+
+namespace
+{
+
+std::vector<int> sorted_random_keys (std::size_t n, unsigned seed)
+{
+    std::mt19937 gen{seed};
+    std::uniform_int_distribution<int> dist{0, 50'000};
+
+    std::vector<int> keys (n);
+    for (auto &key : keys)
+        key = dist (gen);
+    std::sort (keys.begin(), keys.end());
+
+    return keys;
+}
+
+} // unnamed namespace
+
+TEST (Merge_From, Both_Strategies)
+{
+    using yLab::Merge_Strategy;
+
+    auto base = sorted_random_keys (5000, 1);
+    auto batch = sorted_random_keys (3000, 2);
+
+    std::set<int> model (base.begin(), base.end());
+    auto base_size = model.size();
+    model.insert (batch.begin(), batch.end());
+    auto n_new = model.size() - base_size;
+
+    for (auto strategy : {Merge_Strategy::automatic, Merge_Strategy::insert, Merge_Strategy::rebuild})
+    {
+        yLab::RB_Tree<int> tree;
+        tree.merge_from (base);
+
+        EXPECT_EQ (tree.merge_from (batch, strategy), n_new);
+        EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+        EXPECT_TRUE (std::equal (tree.begin(), tree.end(), model.begin(), model.end()));
+
+        // Every key is already there
+        EXPECT_EQ (tree.merge_from (batch, strategy), 0);
+        EXPECT_EQ (tree.size(), model.size());
+    }
+}
+
+TEST (Merge_From, Another_Tree)
+{
+    yLab::RB_Tree<int> lhs, rhs;
+    lhs.insert ({1, 3, 5, 7});
+    rhs.insert ({2, 3, 4, 8, 9});
+
+    EXPECT_EQ (lhs.merge_from (rhs, yLab::Merge_Strategy::rebuild), 4);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (lhs));
+    EXPECT_EQ (std::vector<int>(lhs.begin(), lhs.end()), (std::vector<int>{1, 2, 3, 4, 5, 7, 8, 9}));
+
+    yLab::RB_Tree<int> empty;
+    EXPECT_EQ (empty.merge_from (rhs), rhs.size());
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (empty));
+    EXPECT_EQ (empty.merge_from (std::vector<int>{}), 0);
+}
+
+TEST (Merge_From, Unbalanced_Tree)
+{
+    yLab::RB_Tree<int> tree;
+    tree.merge_from (sorted_random_keys (1000, 3));
+    tree.rebuild_by_frequency ([](int key) { return key % 7; });
+
+    tree.merge_from (sorted_random_keys (1000, 4), yLab::Merge_Strategy::rebuild);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+}
+
+TEST (Merge_From, Rolled_Back_Within_Batch)
+{
+    auto base = sorted_random_keys (2000, 5);
+
+    yLab::RB_Tree<int> tree;
+    tree.merge_from (base);
+    std::vector<int> before (tree.begin(), tree.end());
+
+    tree.begin_batch();
+    tree.merge_from (sorted_random_keys (2000, 6), yLab::Merge_Strategy::rebuild);
+    tree.rollback();
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (std::vector<int>(tree.begin(), tree.end()), before);
+}
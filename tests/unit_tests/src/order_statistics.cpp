@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "invariants.hpp"
+
+TEST (Order_Statistics, Empty_Tree)
+{
+    yLab::RB_Tree<int> tree;
+
+    EXPECT_EQ (tree.kth_smallest (0), tree.end());
+    EXPECT_EQ (tree.count_less (42), 0);
+}
+
+TEST (Order_Statistics, Kth_Smallest)
+{
+    yLab::RB_Tree<int> tree;
+    tree.insert ({8, 3, 10, 1, 6, 14, 4, 7, 13});
+    std::vector<int> sorted = {1, 3, 4, 6, 7, 8, 10, 13, 14};
+
+    for (std::size_t k = 0; k != sorted.size(); ++k)
+        EXPECT_EQ (*tree.kth_smallest (k), sorted[k]);
+
+    EXPECT_EQ (tree.kth_smallest (sorted.size()), tree.end());
+}
+
+TEST (Order_Statistics, Count_Less)
+{
+    yLab::RB_Tree<int> tree;
+    tree.insert ({8, 3, 10, 1, 6, 14, 4, 7, 13});
+
+    EXPECT_EQ (tree.count_less (0), 0);
+    EXPECT_EQ (tree.count_less (1), 0);
+    EXPECT_EQ (tree.count_less (2), 1);
+    EXPECT_EQ (tree.count_less (8), 5);
+    EXPECT_EQ (tree.count_less (9), 6);
+    EXPECT_EQ (tree.count_less (14), 8);
+    EXPECT_EQ (tree.count_less (100), 9);
+}
+
+TEST (Order_Statistics, Random_Inserts)
+{
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> dist{-1000, 1000};
+
+    yLab::RB_Tree<int> tree;
+    std::set<int> model;
+
+    for (auto i = 0; i != 2000; ++i)
+    {
+        auto key = dist (gen);
+        tree.insert (key);
+        model.insert (key);
+    }
+
+    ASSERT_EQ (tree.size(), model.size());
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+
+    std::vector<int> sorted (model.begin(), model.end());
+    for (std::size_t k = 0; k != sorted.size(); ++k)
+        EXPECT_EQ (*tree.kth_smallest (k), sorted[k]);
+
+    for (auto key = -1010; key <= 1010; ++key)
+    {
+        auto expected = std::lower_bound (sorted.begin(), sorted.end(), key) - sorted.begin();
+        EXPECT_EQ (tree.count_less (key), expected);
+    }
+}
+
+TEST (Order_Statistics, Descending_Inserts)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 100; key != 0; --key)
+        tree.insert (key);
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (*tree.begin(), 1);
+    EXPECT_EQ (*tree.kth_smallest (99), 100);
+}
+
+TEST (Order_Statistics, Copy_Keeps_Sizes)
+{
+    yLab::RB_Tree<int> tree;
+    tree.insert ({5, 2, 8, 1, 3, 7, 9, 6});
+    auto copy = tree;
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (copy));
+    EXPECT_EQ (*copy.kth_smallest (4), 6);
+    EXPECT_EQ (copy.count_less (7), 5);
+}
+
+TEST (Order_Statistics, Insert_With_Rank)
+{
+    std::mt19937 gen{17};
+    std::uniform_int_distribution<int> dist{0, 3000};
+
+    yLab::RB_Tree<int> tree;
+    std::set<int> model;
+
+    for (auto i = 0; i != 5000; ++i)
+    {
+        auto key = dist (gen);
+        auto expected_rank = static_cast<std::size_t>(std::distance (model.begin(), model.lower_bound (key)));
+        auto expected_inserted = model.insert (key).second;
+
+        auto [it, rank, inserted] = tree.insert_with_rank (key);
+
+        ASSERT_EQ (*it, key);
+        ASSERT_EQ (rank, expected_rank);
+        ASSERT_EQ (inserted, expected_inserted);
+    }
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_TRUE (std::equal (tree.begin(), tree.end(), model.begin(), model.end()));
+}
+
+TEST (Order_Statistics, Counting_Inversions)
+{
+    std::vector<int> stream = {5, 3, 8, 1, 9, 2, 7};
+
+    // An inversion is a pair of arrivals in which the earlier one is greater
+    yLab::RB_Tree<int> tree;
+    std::size_t n_inversions = 0;
+    for (std::size_t i = 0; i != stream.size(); ++i)
+        n_inversions += i - std::get<1>(tree.insert_with_rank (stream[i]));
+
+    EXPECT_EQ (n_inversions, 10);
+}
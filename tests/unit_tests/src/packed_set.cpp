@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "packed_set.hpp"
+
+namespace
+{
+
+// Sorted unique keys with gaps in [1, max_gap]
+std::vector<std::uint64_t> dense_keys (std::size_t n, std::uint64_t max_gap, unsigned seed)
+{
+    std::mt19937_64 gen{seed};
+    std::uniform_int_distribution<std::uint64_t> gap{1, max_gap};
+
+    std::vector<std::uint64_t> keys (n);
+    std::uint64_t key = gen() % 1'000'000;
+    for (auto &k : keys)
+        k = key += gap (gen);
+
+    return keys;
+}
+
+template <typename Set>
+void expect_same (const yLab::Packed_Set<std::uint64_t> &packed, const Set &expected)
+{
+    ASSERT_EQ (packed.size(), expected.size());
+    EXPECT_TRUE (std::equal (packed.begin(), packed.end(), expected.begin(), expected.end()));
+
+    std::vector<std::uint64_t> scanned;
+    packed.for_each ([&scanned](std::uint64_t key) { scanned.push_back (key); });
+    EXPECT_TRUE (std::equal (scanned.begin(), scanned.end(), expected.begin(), expected.end()));
+}
+
+} // unnamed namespace
+
+TEST (Packed_Set, Empty)
+{
+    yLab::Packed_Set<std::uint64_t> set;
+
+    EXPECT_TRUE (set.empty());
+    EXPECT_EQ (set.begin(), set.end());
+    EXPECT_EQ (set.find (1), set.end());
+    EXPECT_EQ (set.lower_bound (1), set.end());
+    EXPECT_EQ (set.count_less (1), 0);
+    EXPECT_EQ (set.kth_smallest (0), set.end());
+}
+
+TEST (Packed_Set, Empty_Range)
+{
+    std::vector<std::uint64_t> keys;
+    yLab::Packed_Set<std::uint64_t> set (keys.begin(), keys.end());
+
+    EXPECT_TRUE (set.empty());
+    EXPECT_EQ (set.begin(), set.end());
+    EXPECT_EQ (set.find (1), set.end());
+    EXPECT_EQ (set.lower_bound (1), set.end());
+    EXPECT_EQ (set.kth_smallest (0), set.end());
+
+    EXPECT_TRUE (set.insert (5).second);
+    EXPECT_TRUE (set.insert (3).second);
+    EXPECT_FALSE (set.insert (5).second);
+
+    expect_same (set, std::vector<std::uint64_t>{3, 5});
+    EXPECT_EQ (set.count_less (4), 1);
+    EXPECT_EQ (*set.lower_bound (4), 5);
+}
+
+TEST (Packed_Set, Bulk_Load)
+{
+    auto keys = dense_keys (10'000, 20, 1);
+    yLab::Packed_Set<std::uint64_t> set (keys.begin(), keys.end());
+
+    expect_same (set, keys);
+    EXPECT_LT (set.size_in_bytes(), set.size() * sizeof (std::uint64_t) / 3);
+
+    for (std::size_t k = 0; k != keys.size(); ++k)
+    {
+        ASSERT_EQ (*set.kth_smallest (k), keys[k]);
+        ASSERT_EQ (set.count_less (keys[k]), k);
+        ASSERT_TRUE (set.contains (keys[k]));
+        ASSERT_EQ (set.contains (keys[k] + 1), k + 1 != keys.size() && keys[k + 1] == keys[k] + 1);
+    }
+}
+
+TEST (Packed_Set, Insert)
+{
+    std::mt19937_64 gen{2};
+    std::set<std::uint64_t> expected;
+    yLab::Packed_Set<std::uint64_t> set;
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        // Mostly dense keys with a few far away ones that take all 64 bits in a block
+        auto key = (i % 100 == 0) ? gen() : gen() % 50'000;
+
+        auto [it, inserted] = set.insert (key);
+        ASSERT_EQ (inserted, expected.insert (key).second);
+        ASSERT_EQ (*it, key);
+    }
+
+    expect_same (set, expected);
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        auto key = (i % 100 == 0) ? gen() : gen() % 50'000;
+        auto rank = static_cast<std::size_t>(std::distance (expected.begin(), expected.lower_bound (key)));
+
+        ASSERT_EQ (set.count_less (key), rank);
+
+        auto lower = set.lower_bound (key);
+        auto expected_lower = expected.lower_bound (key);
+        if (expected_lower == expected.end())
+            ASSERT_EQ (lower, set.end());
+        else
+            ASSERT_EQ (*lower, *expected_lower);
+
+        auto upper = set.upper_bound (key);
+        auto expected_upper = expected.upper_bound (key);
+        if (expected_upper == expected.end())
+            ASSERT_EQ (upper, set.end());
+        else
+            ASSERT_EQ (*upper, *expected_upper);
+
+        if (rank != expected.size())
+        {
+            ASSERT_EQ (*set.kth_smallest (rank), *expected_lower);
+        }
+    }
+}
+
+TEST (Packed_Set, Ascending_Inserts)
+{
+    // Every insert goes to the last block, so splits grow the index by several levels
+    auto keys = dense_keys (200'000, 5, 3);
+    yLab::Packed_Set<std::uint64_t> set;
+
+    for (auto key : keys)
+        ASSERT_TRUE (set.insert (key).second);
+
+    expect_same (set, keys);
+
+    for (std::size_t k = 0; k < keys.size(); k += 7)
+    {
+        ASSERT_EQ (*set.kth_smallest (k), keys[k]);
+        ASSERT_EQ (set.count_less (keys[k]), k);
+        ASSERT_EQ (set.count_less (keys[k] + 1), k + 1);
+    }
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "rb_map.hpp"
+
+namespace
+{
+
+long expected_sum (const std::map<int, long> &map, int first, int last)
+{
+    long sum = 0;
+    for (auto it = map.lower_bound (first); it != map.end() && it->first <= last; ++it)
+        sum += it->second;
+
+    return sum;
+}
+
+std::optional<long> expected_max (const std::map<int, long> &map, int first, int last)
+{
+    std::optional<long> max;
+    for (auto it = map.lower_bound (first); it != map.end() && it->first <= last; ++it)
+        if (!max || *max < it->second)
+            max = it->second;
+
+    return max;
+}
+
+} // unnamed namespace
+
+TEST (RB_Map, Empty)
+{
+    yLab::RB_Map<int, long> map;
+
+    EXPECT_TRUE (map.empty());
+    EXPECT_EQ (map.value (1), std::nullopt);
+    EXPECT_EQ (map.sum (0, 10), 0);
+    EXPECT_EQ (map.max (0, 10), std::nullopt);
+
+    map.add (0, 10, 5);
+    EXPECT_TRUE (map.empty());
+}
+
+TEST (RB_Map, Range_Add)
+{
+    yLab::RB_Map<int, long> map;
+    for (auto key = 0; key != 10; ++key)
+        map.insert (key, key);
+
+    map.add (2, 5, 100);
+    map.add (4, 20, -1);
+
+    EXPECT_EQ (*map.value (1), 1);
+    EXPECT_EQ (*map.value (3), 103);
+    EXPECT_EQ (*map.value (5), 104);
+    EXPECT_EQ (*map.value (9), 8);
+
+    EXPECT_EQ (map.sum (0, 9), 45 + 400 - 6);
+    EXPECT_EQ (map.sum (3, 4), 103 + 103);
+    EXPECT_EQ (*map.max (0, 9), 104);
+    EXPECT_EQ (*map.max (6, 100), 8);
+
+    // Keys inserted after an update do not get it
+    map.insert (-1, 0);
+    map.insert (100, 0);
+    EXPECT_EQ (map.sum (-5, 200), 45 + 400 - 6);
+}
+
+TEST (RB_Map, For_Each_After_Range_Add)
+{
+    yLab::RB_Map<int, long> map;
+    for (auto key = 0; key != 100; ++key)
+        map.insert (key, 0);
+
+    map.add (0, 99, 5);
+    map.add (10, 19, 1);
+
+    auto expected_key = 0;
+    long sum = 0;
+    map.for_each ([&](int key, long value)
+    {
+        EXPECT_EQ (key, expected_key++);
+        EXPECT_EQ (value, (10 <= key && key < 20) ? 6 : 5);
+        sum += value;
+    });
+
+    EXPECT_EQ (expected_key, 100);
+    EXPECT_EQ (sum, map.sum (0, 99));
+}
+
+TEST (RB_Map, Matches_Map)
+{
+    std::mt19937 gen{6};
+    std::uniform_int_distribution<int> key_dist{0, 3'000};
+    std::uniform_int_distribution<long> delta_dist{-100, 100};
+
+    yLab::RB_Map<int, long> map;
+    std::map<int, long> expected;
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        auto first = key_dist (gen), last = key_dist (gen);
+        if (last < first)
+            std::swap (first, last);
+
+        switch (gen() % 6)
+        {
+            case 5:
+                ASSERT_EQ (map.erase (first), expected.erase (first));
+                break;
+
+            case 0:
+            case 1:
+            {
+                auto value = delta_dist (gen);
+                ASSERT_EQ (map.insert (first, value), expected.emplace (first, value).second);
+                break;
+            }
+
+            case 2:
+            {
+                auto delta = delta_dist (gen);
+                map.add (first, last, delta);
+                for (auto it = expected.lower_bound (first); it != expected.end() && it->first <= last; ++it)
+                    it->second += delta;
+                break;
+            }
+
+            case 3:
+                ASSERT_EQ (map.sum (first, last), expected_sum (expected, first, last));
+                break;
+
+            case 4:
+                ASSERT_EQ (map.max (first, last), expected_max (expected, first, last));
+                break;
+        }
+    }
+
+    for (auto [key, value] : expected)
+        ASSERT_EQ (map.value (key), value);
+
+    auto it = expected.begin();
+    map.for_each ([&](int key, long value)
+    {
+        ASSERT_NE (it, expected.end());
+        EXPECT_EQ (key, it->first);
+        EXPECT_EQ (value, it->second);
+        ++it;
+    });
+    EXPECT_EQ (it, expected.end());
+
+    EXPECT_EQ (map.size(), expected.size());
+}
@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "invariants.hpp"
+
+namespace
+{
+
+// Zipf-like weights: key i is accessed about n / (i + 1) times
+std::size_t zipf_weight (int key) { return 1000 / (key + 1); }
+
+// Number of levels
+std::size_t height (const yLab::RB_Tree<int> &tree)
+{
+    std::size_t height = 0;
+    for (auto it = tree.begin(), ite = tree.end(); it != ite; ++it)
+    {
+        std::size_t depth = 0;
+        for (auto node = it.base(); node != ite.base(); node = node->parent_)
+            depth++;
+        height = std::max (height, depth);
+    }
+
+    return height;
+}
+
+} // unnamed namespace
+
+TEST (Rebuild_By_Frequency, Keeps_Contents)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 1000; ++key)
+        tree.insert (key);
+
+    tree.rebuild_by_frequency (zipf_weight);
+
+    ASSERT_EQ (tree.size(), 1000);
+
+    auto key = 0;
+    for (auto it = tree.begin(); it != tree.end(); ++it)
+        EXPECT_EQ (*it, key++);
+
+    for (key = 0; key != 1000; ++key)
+    {
+        EXPECT_NE (tree.find (key), tree.end());
+        EXPECT_EQ (*tree.kth_smallest (key), key);
+        EXPECT_EQ (tree.count_less (key), key);
+    }
+    EXPECT_EQ (tree.find (1000), tree.end());
+}
+
+TEST (Rebuild_By_Frequency, Reduces_Expected_Depth)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 1000; ++key)
+        tree.insert (key);
+
+    auto report = tree.rebuild_by_frequency (zipf_weight);
+
+    EXPECT_LT (report.expected_depth_after, report.expected_depth_before);
+
+    // Weight of key 0 is more than 1/9 of the total weight, so it is not deeper than the 4th level
+    std::size_t depth = 0;
+    for (auto node = tree.find (0).base(); node != tree.end().base(); node = node->parent_)
+        depth++;
+    EXPECT_LE (depth, 4);
+
+    // Rebuilding with the same weights does not change anything
+    auto again = tree.rebuild_by_frequency (zipf_weight);
+    EXPECT_DOUBLE_EQ (again.expected_depth_before, report.expected_depth_after);
+    EXPECT_DOUBLE_EQ (again.expected_depth_after, report.expected_depth_after);
+}
+
+TEST (Rebuild_By_Frequency, Uniform_Weights_Give_Balanced_Tree)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 1023; ++key)
+        tree.insert (key);
+
+    auto report = tree.rebuild_by_frequency ([](int) { return 1; });
+
+    // Perfect tree with 10 levels
+    EXPECT_NEAR (report.expected_depth_after, (9.0 * 1024 + 1) / 1023, 1e-9);
+}
+
+TEST (Rebuild_By_Frequency, Insertion_Restores_Red_Black_Tree)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 1000; key += 2)
+        tree.insert (key);
+
+    tree.rebuild_by_frequency (zipf_weight);
+    tree.insert (501);
+    tree.insert (0);
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (tree.size(), 501);
+    EXPECT_EQ (tree.count_less (501), 251);
+}
+
+TEST (Rebuild_By_Frequency, Empty_Tree)
+{
+    yLab::RB_Tree<int> tree;
+
+    auto report = tree.rebuild_by_frequency ([](int) { return 1; });
+    EXPECT_EQ (report.expected_depth_after, 0.0);
+
+    tree.insert (1);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+}
+
+TEST (Rebuild_By_Frequency, Rejected_In_Batch)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 100; ++key)
+        tree.insert (key);
+
+    tree.begin_batch();
+    for (auto key = 100; key != 200; ++key)
+        tree.insert (key);
+
+    EXPECT_THROW (tree.rebuild_by_frequency (zipf_weight), std::logic_error);
+    tree.rollback();
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_TRUE (std::ranges::equal (tree, std::views::iota (0, 100)));
+}
+
+#ifdef YLAB_COUNT_ACCESSES
+TEST (Rebuild_By_Frequency, Recorded_Accesses)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 100; ++key)
+        tree.insert (key);
+
+    for (auto i = 0; i != 1000; ++i)
+        tree.find (99);
+
+    auto report = tree.rebuild_by_frequency();
+
+    EXPECT_LT (report.expected_depth_after, report.expected_depth_before);
+    EXPECT_EQ (tree.end().base()->left_->key(), 99);
+}
+#endif
+
+TEST (Rebalance_Perfect, Minimal_Height)
+{
+    std::mt19937 gen{5};
+
+    for (std::size_t n : {0, 1, 2, 3, 4, 7, 8, 100, 1023, 1024, 5000})
+    {
+        std::vector<int> keys (n);
+        for (std::size_t i = 0; i != n; ++i)
+            keys[i] = static_cast<int>(3 * i);
+        std::shuffle (keys.begin(), keys.end(), gen);
+
+        yLab::RB_Tree<int> tree;
+        tree.insert (keys.begin(), keys.end());
+        auto first = tree.begin();
+
+        tree.rebalance_perfect();
+
+        EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree)) << n << " keys";
+        EXPECT_EQ (height (tree), std::bit_width (n)) << n << " keys";
+        EXPECT_EQ (tree.size(), n);
+        EXPECT_EQ (tree.begin(), first);
+
+        std::sort (keys.begin(), keys.end());
+        EXPECT_TRUE (std::equal (tree.begin(), tree.end(), keys.begin(), keys.end()));
+
+        for (std::size_t k = 0; k < n; k += 7)
+        {
+            ASSERT_EQ (*tree.kth_smallest (k), keys[k]);
+            ASSERT_EQ (tree.count_less (keys[k]), k);
+        }
+
+        if (n)
+        {
+            EXPECT_EQ (*std::prev (tree.end()), keys.back());
+        }
+    }
+}
+
+TEST (Rebalance_Perfect, After_Rebuild_By_Frequency)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 1000; ++key)
+        tree.insert (key);
+
+    tree.rebuild_by_frequency (zipf_weight);
+    tree.rebalance_perfect();
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (height (tree), 10);
+
+    tree.insert (1000);
+    tree.erase (0);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (*tree.begin(), 1);
+}
+
+TEST (Rebalance_Perfect, Rejected_In_Batch)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 100; ++key)
+        tree.insert (key);
+
+    tree.begin_batch();
+    for (auto key = 100; key != 200; ++key)
+        tree.insert (key);
+
+    EXPECT_THROW (tree.rebalance_perfect(), std::logic_error);
+    tree.rollback();
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (tree.size(), 100);
+    EXPECT_TRUE (std::ranges::equal (tree, std::views::iota (0, 100)));
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <set>
+#include <thread>
+
+#include "rb_tree.hpp"
+#include "background_rebalancer.hpp"
+#include "invariants.hpp"
+
+namespace
+{
+
+template <typename Key_T>
+std::size_t height (const yLab::RB_Node<Key_T> *node)
+{
+    return (node) ? std::max (height (node->left_), height (node->right_)) + 1 : 0;
+}
+
+} // unnamed namespace
+
+TEST (Relaxed_Balance, Repairs_Incrementally)
+{
+    std::mt19937 gen{7};
+    std::uniform_int_distribution<int> dist{0, 100'000};
+
+    yLab::RB_Tree<int> tree;
+    tree.enable_relaxed_balance (1000);
+
+    std::set<int> model;
+    for (auto i = 0; i != 5000; ++i)
+    {
+        auto key = dist (gen);
+        EXPECT_EQ (tree.insert (key).second, model.insert (key).second);
+    }
+
+    EXPECT_GT (tree.pending_violations(), 0);
+
+    for (auto key : model)
+        EXPECT_NE (tree.find (key), tree.end());
+    EXPECT_EQ (*tree.kth_smallest (100), *std::next (model.begin(), 100));
+
+    // Every step repairs at least one red-red edge
+    auto max_steps = tree.pending_violations() * tree.size();
+    std::size_t n_steps = 0;
+    while (tree.rebalance_step (1))
+        ASSERT_LT (++n_steps, max_steps);
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (tree.size(), model.size());
+}
+
+TEST (Relaxed_Balance, Keeps_Height_Bound)
+{
+    constexpr std::size_t height_bound = 24;
+
+    yLab::RB_Tree<int> tree;
+    tree.enable_relaxed_balance (height_bound);
+
+    for (auto key = 0; key != 2000; ++key)
+    {
+        tree.insert (key);
+        ASSERT_LE (height (tree.end().base()->left_), height_bound);
+    }
+
+    tree.disable_relaxed_balance();
+    EXPECT_EQ (tree.pending_violations(), 0);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+}
+
+TEST (Relaxed_Balance, Mixed_With_Immediate_Fixup)
+{
+    yLab::RB_Tree<int> tree;
+
+    for (auto key = 0; key != 300; key += 3)
+        tree.insert (key);
+
+    tree.enable_relaxed_balance (100);
+    for (auto key = 1; key < 300; key += 3)
+        tree.insert (key);
+
+    auto copy = tree;
+    EXPECT_EQ (copy.pending_violations() != 0, tree.pending_violations() != 0);
+
+    tree.disable_relaxed_balance();
+    for (auto key = 2; key < 300; key += 3)
+        tree.insert (key);
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (tree.size(), 300);
+
+    copy.rebalance();
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (copy));
+    EXPECT_EQ (copy.size(), 200);
+}
+
+TEST (Relaxed_Balance, Background_Thread)
+{
+    yLab::RB_Tree<int> tree;
+    tree.enable_relaxed_balance (64);
+
+    std::mutex mutex;
+    yLab::Background_Rebalancer<int> rebalancer{tree, mutex, 16, std::chrono::microseconds{10}};
+
+    std::mt19937 gen{3};
+    std::uniform_int_distribution<int> dist{0, 1'000'000};
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        std::lock_guard lock{mutex};
+        tree.insert (dist (gen));
+    }
+
+    // The rebalancer cannot run while the lock is held, so these violations are left to it
+    {
+        std::lock_guard lock{mutex};
+        for (auto i = 0; i != 1'000; ++i)
+            tree.insert (dist (gen));
+
+        ASSERT_GT (tree.pending_violations(), 0);
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    for (;;)
+    {
+        {
+            std::lock_guard lock{mutex};
+            if (tree.pending_violations() == 0)
+                break;
+        }
+
+        ASSERT_LT (std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for (std::chrono::milliseconds{1});
+    }
+
+    std::lock_guard lock{mutex};
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+}
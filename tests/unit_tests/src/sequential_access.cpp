@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "invariants.hpp"
+
+namespace
+{
+
+// Checks lookups of n keys first, first + step, ... with a cursor against std::set
+void expect_same_lookups (const yLab::RB_Tree<int> &tree, yLab::RB_Tree<int>::Cursor &cursor,
+                          const std::set<int> &expected, int first, int n, int step)
+{
+    for (auto key = first; n--; key += step)
+    {
+        auto found = tree.find (cursor, key);
+        ASSERT_EQ (found != tree.end(), expected.contains (key));
+
+        auto lower = tree.lower_bound (cursor, key);
+        auto expected_lower = expected.lower_bound (key);
+        ASSERT_EQ (lower == tree.end(), expected_lower == expected.end());
+        if (lower != tree.end())
+        {
+            ASSERT_EQ (*lower, *expected_lower);
+        }
+
+        auto upper = tree.upper_bound (cursor, key);
+        auto expected_upper = expected.upper_bound (key);
+        ASSERT_EQ (upper == tree.end(), expected_upper == expected.end());
+        if (upper != tree.end())
+        {
+            ASSERT_EQ (*upper, *expected_upper);
+        }
+    }
+}
+
+} // unnamed namespace
+
+TEST (Sequential_Access, Ascending_And_Descending_Inserts)
+{
+    yLab::RB_Tree<int> tree;
+    std::set<int> expected;
+
+    for (auto key = 0; key < 10'000; key += 3)
+    {
+        tree.insert (key);
+        expected.insert (key);
+    }
+
+    for (auto key = 29'999; key > 10'000; key -= 7)
+    {
+        tree.insert (key);
+        expected.insert (key);
+    }
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_TRUE (std::equal (tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
+TEST (Sequential_Access, Cursor_Lookups)
+{
+    std::mt19937 gen{4};
+    std::uniform_int_distribution<int> dist{0, 50'000};
+
+    yLab::RB_Tree<int> tree;
+    std::set<int> expected;
+    for (auto i = 0; i != 10'000; ++i)
+    {
+        auto key = dist (gen);
+        tree.insert (key);
+        expected.insert (key);
+    }
+
+    yLab::RB_Tree<int>::Cursor cursor;
+
+    expect_same_lookups (tree, cursor, expected, -10, 50'020, 1);
+    expect_same_lookups (tree, cursor, expected, 50'010, 50'020, -1);
+    expect_same_lookups (tree, cursor, expected, 0, 500, 97);
+
+    // Random keys interrupt runs
+    for (auto i = 0; i != 1'000; ++i)
+    {
+        auto key = dist (gen);
+        expect_same_lookups (tree, cursor, expected, key, 5, 1);
+    }
+}
+
+TEST (Sequential_Access, Cursor_Starts_Over_After_Changes)
+{
+    yLab::RB_Tree<int> tree, other;
+    std::set<int> expected;
+    for (auto key = 0; key != 1'000; ++key)
+    {
+        tree.insert (key);
+        other.insert (key + 1'000);
+        expected.insert (key);
+    }
+
+    yLab::RB_Tree<int>::Cursor cursor;
+    expect_same_lookups (tree, cursor, expected, 0, 500, 1);
+
+    // The cursor remembers a node that is erased
+    for (auto key = 400; key != 600; ++key)
+    {
+        tree.erase (key);
+        expected.erase (key);
+    }
+
+    expect_same_lookups (tree, cursor, expected, 500, 500, 1);
+
+    // A cursor of one tree is not followed into another
+    ASSERT_EQ (*other.lower_bound (cursor, 0), 1'000);
+    ASSERT_EQ (*other.upper_bound (cursor, 1'500), 1'501);
+}
+
+TEST (Sequential_Access, Cursor_Outlives_Tree)
+{
+    std::optional<yLab::RB_Tree<int>> tree;
+    yLab::RB_Tree<int>::Cursor cursor;
+
+    // Every round builds a tree in the same storage with the same number of insertions,
+    // so each of them has the same address and the same version
+    for (auto round = 0; round != 10; ++round)
+    {
+        tree.emplace();
+
+        std::set<int> expected;
+        for (auto key = 0; key != 1'000; ++key)
+        {
+            tree->insert (key * 2 + round);
+            expected.insert (key * 2 + round);
+        }
+
+        expect_same_lookups (*tree, cursor, expected, 0, 500, 3);
+        tree.reset();
+    }
+}
+
+TEST (Sequential_Access, Lookups_Do_Not_Write)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 10'000; ++key)
+        tree.insert (key);
+
+    // Lookups on a non-const tree from several threads under a shared lock
+    std::vector<std::thread> threads;
+    for (auto t = 0; t != 4; ++t)
+        threads.emplace_back ([&tree, t]
+        {
+            yLab::RB_Tree<int>::Cursor cursor;
+            for (auto key = t; key < 10'000; key += 4)
+            {
+                ASSERT_EQ (*tree.find (key), key);
+                ASSERT_EQ (*tree.lower_bound (key), key);
+                ASSERT_EQ (*tree.lower_bound (cursor, key), key);
+            }
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+}
+
+TEST (Sequential_Access, Rollback_Forgets_Finger)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 100; ++key)
+        tree.insert (key);
+
+    tree.begin_batch();
+    for (auto key = 100; key != 200; ++key)
+        tree.insert (key);
+    tree.rollback();
+
+    for (auto key = 0; key != 300; ++key)
+        ASSERT_EQ (tree.find (key) != tree.end(), key < 100);
+
+    for (auto key = 100; key != 200; ++key)
+        tree.insert (key);
+
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (tree.size(), 200);
+}
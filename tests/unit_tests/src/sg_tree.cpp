@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "sg_tree.hpp"
+
+namespace
+{
+
+template <typename Key_T>
+::testing::AssertionResult is_valid_sg_tree (const yLab::SG_Tree<Key_T> &tree)
+{
+    std::size_t n_nodes = 0;
+
+    for (auto it = tree.begin(), ite = tree.end(); it != ite; ++it, ++n_nodes)
+    {
+        auto node = it.base();
+
+        auto size = 1 + yLab::details::size (node->left_) + yLab::details::size (node->right_);
+        if (node->size_ != size)
+            return ::testing::AssertionFailure() << "wrong size of the subtree of " << *it;
+
+        if (node->left_ && node->left_->parent_ != node)
+            return ::testing::AssertionFailure() << "wrong parent of the left child of " << *it;
+        if (node->right_ && node->right_->parent_ != node)
+            return ::testing::AssertionFailure() << "wrong parent of the right child of " << *it;
+
+        if (std::next (it) != ite && !(*it < *std::next (it)))
+            return ::testing::AssertionFailure() << "keys are not sorted at " << *it;
+    }
+
+    if (n_nodes != tree.size())
+        return ::testing::AssertionFailure() << n_nodes << " nodes, size () = " << tree.size();
+
+    if (!tree.empty() && *std::prev (tree.end()) != *std::max_element (tree.begin(), tree.end()))
+        return ::testing::AssertionFailure() << "wrong rightmost node";
+
+    return ::testing::AssertionSuccess();
+}
+
+std::size_t height (const yLab::SG_Tree<int> &tree)
+{
+    std::size_t height = 0;
+    for (auto it = tree.begin(), ite = tree.end(); it != ite; ++it)
+    {
+        std::size_t depth = 0;
+        for (auto node = it.base(); node->parent_ != tree.end().base(); node = node->parent_)
+            depth++;
+        height = std::max (height, depth);
+    }
+
+    return height;
+}
+
+} // unnamed namespace
+
+TEST (SG_Tree, Empty)
+{
+    yLab::SG_Tree<int> tree;
+
+    EXPECT_TRUE (tree.empty());
+    EXPECT_EQ (tree.begin(), tree.end());
+    EXPECT_EQ (tree.find (1), tree.end());
+    EXPECT_EQ (tree.lower_bound (1), tree.end());
+    EXPECT_EQ (tree.kth_smallest (0), tree.end());
+    EXPECT_EQ (tree.count_less (1), 0);
+    EXPECT_EQ (tree.erase (1), 0);
+}
+
+TEST (SG_Tree, Ascending_Inserts_Stay_Low)
+{
+    yLab::SG_Tree<int> tree;
+    for (auto key = 0; key != 10'000; ++key)
+        tree.insert (key);
+
+    EXPECT_TRUE (is_valid_sg_tree (tree));
+    EXPECT_LE (height (tree), std::log (tree.size()) / std::log (1 / tree.alpha()));
+    EXPECT_GT (tree.n_rebuilds(), 0);
+
+    for (auto key = 0; key != 10'000; ++key)
+        ASSERT_EQ (*tree.find (key), key);
+}
+
+TEST (SG_Tree, Random_Against_Set)
+{
+    std::mt19937 gen{11};
+    std::uniform_int_distribution<int> dist{0, 5'000};
+
+    yLab::SG_Tree<int> tree{0.6};
+    std::set<int> expected;
+
+    for (auto i = 0; i != 30'000; ++i)
+    {
+        auto key = dist (gen);
+        if (gen() % 3)
+            ASSERT_EQ (tree.insert (key).second, expected.insert (key).second);
+        else
+            ASSERT_EQ (tree.erase (key), expected.erase (key));
+
+        if (i % 1'000 == 0)
+        {
+            ASSERT_TRUE (is_valid_sg_tree (tree));
+            ASSERT_TRUE (std::equal (tree.begin(), tree.end(), expected.begin(), expected.end()));
+        }
+    }
+
+    for (auto key : {-1, 0, 42, 2'500, 5'000, 5'001})
+    {
+        auto it = tree.lower_bound (key);
+        auto expected_it = expected.lower_bound (key);
+        ASSERT_EQ (it == tree.end(), expected_it == expected.end());
+        if (it != tree.end())
+        {
+            EXPECT_EQ (*it, *expected_it);
+        }
+
+        auto rank = static_cast<std::size_t>(std::distance (expected.begin(), expected_it));
+        EXPECT_EQ (tree.count_less (key), rank);
+        if (rank != expected.size())
+        {
+            EXPECT_EQ (*tree.kth_smallest (rank), *expected_it);
+        }
+    }
+}
+
+TEST (SG_Tree, Erase_All)
+{
+    yLab::SG_Tree<int> tree;
+    tree.insert ({5, 1, 9, 3, 7});
+
+    for (auto it = tree.begin(); it != tree.end();)
+        it = tree.erase (it);
+
+    EXPECT_TRUE (tree.empty());
+    EXPECT_EQ (tree.begin(), tree.end());
+
+    tree.insert (4);
+    EXPECT_EQ (*tree.begin(), 4);
+    EXPECT_TRUE (is_valid_sg_tree (tree));
+}
+
+TEST (SG_Tree, Copy_And_Move)
+{
+    yLab::SG_Tree<int> tree;
+    for (auto key = 0; key != 1'000; ++key)
+        tree.insert (key * 7 % 1'000);
+
+    auto copy = tree;
+    EXPECT_TRUE (is_valid_sg_tree (copy));
+    EXPECT_TRUE (std::equal (copy.begin(), copy.end(), tree.begin(), tree.end()));
+    EXPECT_EQ (height (copy), 9); // perfectly balanced
+
+    auto moved = std::move (copy);
+    EXPECT_TRUE (is_valid_sg_tree (moved));
+    EXPECT_EQ (moved.size(), 1'000);
+
+    moved = tree;
+    EXPECT_EQ (moved.size(), tree.size());
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "skip_list.hpp"
+
+namespace
+{
+
+// Checks order statistics of the list against a sorted vector of its keys
+::testing::AssertionResult has_keys (const yLab::Concurrent_Skip_List<int> &list,
+                                     const std::vector<int> &keys)
+{
+    if (list.size() != keys.size())
+        return ::testing::AssertionFailure() << "size " << list.size() << " != " << keys.size();
+
+    if (!std::equal (list.begin(), list.end(), keys.begin(), keys.end()))
+        return ::testing::AssertionFailure() << "iteration does not match";
+
+    for (std::size_t k = 0; k != keys.size(); ++k)
+    {
+        auto it = list.kth_smallest (k);
+        if (it == list.end() || *it != keys[k])
+            return ::testing::AssertionFailure() << "kth_smallest (" << k << ") is wrong";
+
+        if (list.count_less (keys[k]) != k)
+            return ::testing::AssertionFailure() << "count_less (" << keys[k] << ") is wrong";
+    }
+
+    if (list.kth_smallest (keys.size()) != list.end())
+        return ::testing::AssertionFailure() << "kth_smallest (size()) is not end()";
+
+    return ::testing::AssertionSuccess();
+}
+
+} // unnamed namespace
+
+TEST (Concurrent_Skip_List, Matches_Set)
+{
+    std::mt19937 gen{1};
+    std::uniform_int_distribution<int> key_dist{0, 2000};
+    std::uniform_int_distribution<int> op_dist{0, 2};
+
+    yLab::Concurrent_Skip_List<int> list;
+    std::set<int> model;
+
+    EXPECT_TRUE (list.empty());
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        auto key = key_dist (gen);
+        switch (op_dist (gen))
+        {
+            case 0:
+                ASSERT_EQ (list.insert (key).second, model.insert (key).second);
+                break;
+            case 1:
+                ASSERT_EQ (list.erase (key), model.erase (key));
+                break;
+            default:
+                ASSERT_EQ (list.contains (key), model.contains (key));
+                break;
+        }
+    }
+
+    EXPECT_TRUE (has_keys (list, std::vector<int>(model.begin(), model.end())));
+
+    for (auto key = -1; key != 2002; ++key)
+    {
+        auto lower = model.lower_bound (key);
+        auto upper = model.upper_bound (key);
+
+        if (lower == model.end())
+            ASSERT_EQ (list.lower_bound (key), list.end());
+        else
+            ASSERT_EQ (*list.lower_bound (key), *lower);
+
+        if (upper == model.end())
+            ASSERT_EQ (list.upper_bound (key), list.end());
+        else
+            ASSERT_EQ (*list.upper_bound (key), *upper);
+    }
+}
+
+TEST (Concurrent_Skip_List, Non_Trivial_Keys)
+{
+    yLab::Concurrent_Skip_List<std::string> list;
+
+    for (auto i = 0; i != 1000; ++i)
+        list.insert (std::to_string (i));
+    for (auto i = 0; i != 1000; i += 2)
+        EXPECT_EQ (list.erase (std::to_string (i)), 1);
+
+    EXPECT_EQ (list.size(), 500);
+    EXPECT_EQ (*list.kth_smallest (0), "1");
+    EXPECT_FALSE (list.contains ("998"));
+}
+
+TEST (Concurrent_Skip_List, Concurrent_Disjoint_Ranges)
+{
+    constexpr int n_threads = 8;
+    constexpr int n_keys = 20'000;
+
+    yLab::Concurrent_Skip_List<int> list;
+    {
+        std::vector<std::jthread> threads;
+        for (auto t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&list, t]
+            {
+                std::vector<int> keys;
+                for (auto key = t; key < n_keys; key += n_threads)
+                    keys.push_back (key);
+                std::shuffle (keys.begin(), keys.end(), std::mt19937{static_cast<unsigned>(t)});
+
+                for (auto key : keys)
+                    list.insert (key);
+                for (auto key : keys)
+                    if (key % 3 == 0)
+                        list.erase (key);
+            });
+    }
+
+    std::vector<int> expected;
+    for (auto key = 0; key != n_keys; ++key)
+        if (key % 3 != 0)
+            expected.push_back (key);
+
+    EXPECT_TRUE (has_keys (list, expected));
+}
+
+TEST (Concurrent_Skip_List, Concurrent_Contended_Keys)
+{
+    constexpr int n_threads = 8;
+    constexpr int key_range = 256;
+
+    yLab::Concurrent_Skip_List<int> list;
+    std::vector<long> balance (n_threads * key_range);
+    {
+        std::vector<std::jthread> threads;
+        for (auto t = 0; t != n_threads; ++t)
+            threads.emplace_back ([&, t]
+            {
+                std::mt19937 gen{static_cast<unsigned>(t)};
+                for (auto i = 0; i != 50'000; ++i)
+                {
+                    auto key = static_cast<int>(gen() % key_range);
+                    switch (gen() % 3)
+                    {
+                        case 0:
+                            balance[t * key_range + key] += list.insert (key).second;
+                            break;
+                        case 1:
+                            balance[t * key_range + key] -= static_cast<long>(list.erase (key));
+                            break;
+                        default:
+                            list.kth_smallest (gen() % key_range);
+                            break;
+                    }
+                }
+            });
+    }
+
+    // Every key was inserted one more time than erased if it is in the list
+    std::vector<int> expected;
+    for (auto key = 0; key != key_range; ++key)
+    {
+        long total = 0;
+        for (auto t = 0; t != n_threads; ++t)
+            total += balance[t * key_range + key];
+
+        ASSERT_EQ (total, list.contains (key) ? 1 : 0);
+        if (total)
+            expected.push_back (key);
+    }
+
+    EXPECT_TRUE (has_keys (list, expected));
+}
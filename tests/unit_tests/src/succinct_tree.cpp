@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "bit_vector.hpp"
+#include "succinct_tree.hpp"
+
+TEST (Bit_Vector, Rank_Select)
+{
+    std::mt19937 gen{1};
+
+    for (std::size_t size : {0, 1, 63, 64, 65, 511, 512, 513, 5000})
+    {
+        std::vector<bool> bits (size);
+        for (std::size_t i = 0; i != size; ++i)
+            bits[i] = gen() % 3 == 0;
+
+        yLab::Bit_Vector vector{bits};
+
+        std::size_t rank = 0;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            ASSERT_EQ (vector[i], bits[i]);
+            ASSERT_EQ (vector.rank1 (i), rank);
+
+            if (bits[i])
+            {
+                ASSERT_EQ (vector.select1 (rank++), i);
+            }
+        }
+
+        ASSERT_EQ (vector.rank1 (size), rank);
+        ASSERT_EQ (vector.n_ones(), rank);
+    }
+}
+
+TEST (Succinct_Tree, Empty)
+{
+    yLab::RB_Tree<int> tree;
+    yLab::Succinct_Tree<int> succinct{tree};
+
+    EXPECT_TRUE (succinct.empty());
+    EXPECT_EQ (succinct.begin(), succinct.end());
+    EXPECT_EQ (succinct.find (1), succinct.end());
+    EXPECT_EQ (succinct.lower_bound (1), succinct.end());
+}
+
+TEST (Succinct_Tree, Matches_Tree)
+{
+    std::mt19937 gen{2};
+    std::uniform_int_distribution<int> dist{0, 100'000};
+
+    yLab::RB_Tree<int> tree;
+    for (auto i = 0; i != 20'000; ++i)
+        tree.insert (dist (gen));
+
+    yLab::Succinct_Tree<int> succinct{tree};
+
+    EXPECT_EQ (succinct.size(), tree.size());
+    EXPECT_TRUE (std::equal (succinct.begin(), succinct.end(), tree.begin(), tree.end()));
+    EXPECT_LT (succinct.size_in_bytes(), succinct.size() * (sizeof (int) + 1));
+
+    for (auto i = 0; i != 20'000; ++i)
+    {
+        auto key = dist (gen);
+
+        ASSERT_EQ (succinct.contains (key), tree.contains (key));
+
+        auto lower = tree.lower_bound (key);
+        if (lower == tree.end())
+            ASSERT_EQ (succinct.lower_bound (key), succinct.end());
+        else
+            ASSERT_EQ (*succinct.lower_bound (key), *lower);
+
+        auto upper = tree.upper_bound (key);
+        if (upper == tree.end())
+            ASSERT_EQ (succinct.upper_bound (key), succinct.end());
+        else
+            ASSERT_EQ (*succinct.upper_bound (key), *upper);
+    }
+}
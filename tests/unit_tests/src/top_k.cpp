@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "top_k.hpp"
+#include "invariants.hpp"
+
+TEST (Top_K, Keeps_Greatest)
+{
+    std::mt19937 gen{9};
+
+    yLab::Top_K<int> top{100};
+    std::vector<int> stream (50'000);
+    for (auto &key : stream)
+        key = static_cast<int>(gen() % 1'000'000);
+
+    top.insert (stream.begin(), stream.end());
+
+    std::sort (stream.begin(), stream.end(), std::greater<>{});
+    stream.erase (std::unique (stream.begin(), stream.end()), stream.end());
+    stream.resize (100);
+    std::reverse (stream.begin(), stream.end());
+
+    EXPECT_TRUE (top.full());
+    EXPECT_EQ (top.min(), stream.front());
+    EXPECT_TRUE (std::equal (top.begin(), top.end(), stream.begin(), stream.end()));
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (top.tree()));
+}
+
+TEST (Top_K, Rejects_And_Ignores_Duplicates)
+{
+    yLab::Top_K<int> top{3};
+
+    EXPECT_TRUE (top.insert (5));
+    EXPECT_TRUE (top.insert (7));
+    EXPECT_FALSE (top.insert (7));
+    EXPECT_TRUE (top.insert (1));
+    EXPECT_TRUE (top.full());
+
+    EXPECT_FALSE (top.insert (1));
+    EXPECT_FALSE (top.insert (0));
+    EXPECT_FALSE (top.insert (7));
+    EXPECT_EQ (top.min(), 1);
+
+    EXPECT_TRUE (top.insert (6));
+    EXPECT_EQ (top.min(), 5);
+    EXPECT_EQ (top.size(), 3);
+}
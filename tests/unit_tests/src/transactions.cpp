@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "rb_tree.hpp"
+#include "invariants.hpp"
+
+namespace
+{
+
+using shape_type = std::vector<std::tuple<int, yLab::RB_Color, std::size_t>>;
+
+// Preorder traversal with nil nodes
+void shape (const yLab::RB_Node<int> *node, shape_type &result)
+{
+    if (node == nullptr)
+    {
+        result.emplace_back (0, yLab::RB_Color::black, 0);
+        return;
+    }
+
+    result.emplace_back (node->key(), node->color_, node->size_);
+    shape (node->left_, result);
+    shape (node->right_, result);
+}
+
+shape_type shape (const yLab::RB_Tree<int> &tree)
+{
+    shape_type result;
+    shape (tree.end().base()->left_, result);
+
+    return result;
+}
+
+} // unnamed namespace
+
+TEST (Transactions, Commit)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 100; key += 2)
+        tree.insert (key);
+
+    tree.begin_batch();
+    for (auto key = 1; key < 100; key += 2)
+        tree.insert (key);
+
+    EXPECT_TRUE (tree.in_batch());
+    EXPECT_TRUE (tree.contains (51));
+    EXPECT_EQ (tree.count_less (51), 51);
+
+    tree.commit();
+
+    EXPECT_FALSE (tree.in_batch());
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (tree.size(), 100);
+}
+
+TEST (Transactions, Rollback_Restores_Tree)
+{
+    std::mt19937 gen{11};
+    std::uniform_int_distribution<int> dist{0, 100'000};
+
+    yLab::RB_Tree<int> tree;
+    for (auto i = 0; i != 1000; ++i)
+        tree.insert (dist (gen));
+
+    auto before = shape (tree);
+    auto size = tree.size();
+    auto first = *tree.begin();
+
+    tree.begin_batch();
+    for (auto i = 0; i != 500; ++i)
+        tree.insert (dist (gen));
+    tree.insert (-1);
+    tree.rollback();
+
+    EXPECT_EQ (shape (tree), before);
+    EXPECT_EQ (tree.size(), size);
+    EXPECT_EQ (*tree.begin(), first);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+
+    tree.insert (100'001);
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+}
+
+// Ascending keys make the tree too high, so rotations happen within the batch
+TEST (Transactions, Rollback_Undoes_Rotations)
+{
+    yLab::RB_Tree<int> tree;
+    for (auto key = 0; key != 64; ++key)
+        tree.insert (key);
+
+    auto before = shape (tree);
+
+    tree.begin_batch();
+    for (auto key = 64; key != 5000; ++key)
+        tree.insert (key);
+    tree.rollback();
+
+    EXPECT_EQ (shape (tree), before);
+    EXPECT_EQ (tree.size(), 64);
+    EXPECT_EQ (*tree.kth_smallest (63), 63);
+    EXPECT_EQ (tree.find (64), tree.end());
+}
+
+TEST (Transactions, Rollback_Of_Empty_Tree)
+{
+    yLab::RB_Tree<int> tree;
+
+    tree.begin_batch();
+    tree.insert ({3, 1, 2});
+    tree.rollback();
+
+    EXPECT_TRUE (tree.empty());
+    EXPECT_EQ (tree.begin(), tree.end());
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+
+    tree.insert (5);
+    EXPECT_EQ (*tree.begin(), 5);
+}
+
+TEST (Transactions, Relaxed_Mode)
+{
+    yLab::RB_Tree<int> tree;
+    tree.enable_relaxed_balance (40);
+    for (auto key = 0; key != 200; key += 2)
+        tree.insert (key);
+
+    tree.begin_batch();
+    EXPECT_EQ (tree.pending_violations(), 0);
+
+    for (auto key = 1; key < 200; key += 2)
+        tree.insert (key);
+    tree.commit();
+
+    tree.rebalance();
+    EXPECT_TRUE (yLab::test::is_valid_rb_tree (tree));
+    EXPECT_EQ (tree.size(), 200);
+}